@@ -40,6 +40,7 @@
 #include "chrome/common/chrome_paths.h"
 #include "components/component_updater/component_updater_service.h"
 #include "components/component_updater/timer_update_scheduler.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/child_process_security_policy.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -67,6 +68,8 @@
 #if BUILDFLAG(ENABLE_TOR)
 #include "brave/components/tor/brave_tor_client_updater.h"
 #include "brave/components/tor/pref_names.h"
+#include "brave/components/tor/tor_prewarm_service.h"
+#include "chrome/browser/after_startup_task_utils.h"
 #endif
 
 #if BUILDFLAG(IPFS_ENABLED)
@@ -210,6 +213,13 @@ void BraveBrowserProcessImpl::StartBraveServices() {
   // Now start the local data files service, which calls all observers.
   local_data_files_service()->Start();
 
+#if BUILDFLAG(ENABLE_TOR)
+  AfterStartupTaskUtils::PostTask(
+      FROM_HERE, content::GetUIThreadTaskRunner({}),
+      base::BindOnce(&BraveBrowserProcessImpl::StartTorPrewarm,
+                     base::Unretained(this)));
+#endif
+
 #if BUILDFLAG(ENABLE_BRAVE_SYNC)
   brave_sync::NetworkTimeHelper::GetInstance()
     ->SetNetworkTimeTracker(g_browser_process->network_time_tracker());
@@ -324,6 +334,17 @@ BraveBrowserProcessImpl::tor_client_updater() {
   return tor_client_updater_.get();
 }
 
+void BraveBrowserProcessImpl::StartTorPrewarm() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!tor_prewarm_service_) {
+    base::FilePath user_data_dir;
+    base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir);
+    tor_prewarm_service_ = std::make_unique<tor::TorPrewarmService>(
+        local_state(), tor_client_updater(), user_data_dir);
+  }
+  tor_prewarm_service_->Start();
+}
+
 void BraveBrowserProcessImpl::OnTorEnabledChanged() {
   // Update all browsers' tor command status.
   for (Browser* browser : *BrowserList::GetInstance()) {
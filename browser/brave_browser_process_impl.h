@@ -55,6 +55,7 @@ class NTPBackgroundImagesService;
 
 namespace tor {
 class BraveTorClientUpdater;
+class TorPrewarmService;
 }
 
 namespace ipfs {
@@ -120,6 +121,7 @@ class BraveBrowserProcessImpl : public BrowserProcessImpl {
 
 #if BUILDFLAG(ENABLE_TOR)
   void OnTorEnabledChanged();
+  void StartTorPrewarm();
 #endif
 
   void UpdateBraveDarkMode();
@@ -153,6 +155,7 @@ class BraveBrowserProcessImpl : public BrowserProcessImpl {
 #endif
 #if BUILDFLAG(ENABLE_TOR)
   std::unique_ptr<tor::BraveTorClientUpdater> tor_client_updater_;
+  std::unique_ptr<tor::TorPrewarmService> tor_prewarm_service_;
 #endif
 #if BUILDFLAG(IPFS_ENABLED)
   std::unique_ptr<ipfs::BraveIpfsClientUpdater> ipfs_client_updater_;
@@ -3,6 +3,12 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <atomic>
+#include <vector>
+
+#include "base/barrier_closure.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
 #include "base/path_service.h"
 #include "base/scoped_observer.h"
 #include "brave/browser/brave_wallet/brave_wallet_service_factory.h"
@@ -48,6 +54,39 @@ std::unique_ptr<net::test_server::HttpResponse> HandleRequest(
   return std::move(http_response);
 }
 
+// Answers JSON-RPC batches the way Infura does, one response per call in the
+// array, and counts how many HTTP requests reached the server.
+std::unique_ptr<net::test_server::HttpResponse> HandleBatchRequest(
+    std::atomic<int>* request_count,
+    const net::test_server::HttpRequest& request) {
+  ++*request_count;
+  std::unique_ptr<net::test_server::BasicHttpResponse> http_response(
+      new net::test_server::BasicHttpResponse());
+  http_response->set_code(net::HTTP_OK);
+  http_response->set_content_type("application/json");
+
+  base::Optional<base::Value> calls = base::JSONReader::Read(request.content);
+  if (!calls || !calls->is_list())
+    return HandleRequest(request);
+
+  base::Value responses(base::Value::Type::LIST);
+  for (const auto& call : calls->GetList()) {
+    const std::string* method = call.FindStringKey("method");
+    base::Value response(base::Value::Type::DICTIONARY);
+    response.SetStringKey("jsonrpc", "2.0");
+    response.SetIntKey("id", call.FindIntKey("id").value_or(-1));
+    response.SetStringKey("result", method && *method == "eth_call"
+                                        ? "0x00000000000000000000000000000000"
+                                          "000000000000000166e12cfce39a0000"
+                                        : "0xb539d5");
+    responses.Append(std::move(response));
+  }
+  std::string content;
+  base::JSONWriter::Write(responses, &content);
+  http_response->set_content(content);
+  return std::move(http_response);
+}
+
 std::unique_ptr<net::test_server::HttpResponse> HandleRequestServerError(
     const net::test_server::HttpRequest& request) {
   std::unique_ptr<net::test_server::BasicHttpResponse> http_response(
@@ -215,3 +254,43 @@ IN_PROC_BROWSER_TEST_F(EthJsonRpcBrowserTest, GetERC20TokenBalance) {
       "0x00000000000000000000000000000000000000000000000166e12cfce39a0000",
       true);
 }
+
+IN_PROC_BROWSER_TEST_F(EthJsonRpcBrowserTest, GetERC20TokenBalancesBatched) {
+  std::atomic<int> request_count(0);
+  ResetHTTPSServer(base::BindRepeating(&HandleBatchRequest, &request_count));
+  auto* controller = GetEthJsonRpcController();
+  const std::vector<std::string> contracts = {
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef",
+      "0x6b175474e89094c44da98b954eedeac495271d0f",
+      "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"};
+
+  auto fetch_balances = [&]() {
+    base::RunLoop run_loop;
+    auto barrier =
+        base::BarrierClosure(contracts.size(), run_loop.QuitClosure());
+    for (const auto& contract : contracts) {
+      controller->GetERC20TokenBalance(
+          contract, "0x4e02f254184E904300e0775E4b8eeCB1",
+          base::BindOnce(
+              [](base::RepeatingClosure barrier, bool success,
+                 const std::string& balance) {
+                EXPECT_TRUE(success);
+                EXPECT_EQ("0x00000000000000000000000000000000000000000000000"
+                          "166e12cfce39a0000",
+                          balance);
+                barrier.Run();
+              },
+              barrier));
+    }
+    run_loop.Run();
+  };
+
+  // All balances go out in one batch.
+  fetch_balances();
+  EXPECT_EQ(1, request_count);
+
+  // The block number has not changed, so the same balances are served from
+  // the cache.
+  fetch_balances();
+  EXPECT_EQ(1, request_count);
+}
@@ -23,6 +23,8 @@
 #include "chrome/test/base/ui_test_utils.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/browser_test_utils.h"
+#include "extensions/browser/extension_registry.h"
+#include "extensions/browser/extension_registry_observer.h"
 #include "net/dns/mock_host_resolver.h"
 #include "ui/base/ui_base_switches.h"
 
@@ -91,6 +93,40 @@ class GreaselionServiceWaiter : public GreaselionService::Observer {
   DISALLOW_COPY_AND_ASSIGN(GreaselionServiceWaiter);
 };
 
+// Counts extensions loaded and unloaded in a profile while it is alive.
+class ExtensionLoadCounter : public extensions::ExtensionRegistryObserver {
+ public:
+  explicit ExtensionLoadCounter(content::BrowserContext* context)
+      : scoped_observer_(this) {
+    scoped_observer_.Add(extensions::ExtensionRegistry::Get(context));
+  }
+  ~ExtensionLoadCounter() override = default;
+
+  int loaded() const { return loaded_; }
+  int unloaded() const { return unloaded_; }
+
+ private:
+  // extensions::ExtensionRegistryObserver:
+  void OnExtensionLoaded(content::BrowserContext* browser_context,
+                         const extensions::Extension* extension) override {
+    loaded_++;
+  }
+  void OnExtensionUnloaded(
+      content::BrowserContext* browser_context,
+      const extensions::Extension* extension,
+      extensions::UnloadedExtensionReason reason) override {
+    unloaded_++;
+  }
+
+  int loaded_ = 0;
+  int unloaded_ = 0;
+  ScopedObserver<extensions::ExtensionRegistry,
+                 extensions::ExtensionRegistryObserver>
+      scoped_observer_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExtensionLoadCounter);
+};
+
 class GreaselionServiceTest : public BaseLocalDataFilesBrowserTest {
  public:
   GreaselionServiceTest(): https_server_(net::EmbeddedTestServer::TYPE_HTTPS) {
@@ -354,6 +390,42 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsGreaselionExtension) {
   EXPECT_TRUE(greaselion_service->IsGreaselionExtension(extension_ids[0]));
 }
 
+IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, OnlyChangedRulesReinstalled) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+  auto extension_ids = greaselion_service->GetExtensionIdsForTesting();
+  ASSERT_GT(extension_ids.size(), 0UL);
+  ExtensionLoadCounter counter(profile());
+
+  // No test rule depends on ads, so nothing is reinstalled.
+  greaselion_service->SetFeatureEnabled(greaselion::ADS, true);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  EXPECT_EQ(extension_ids, greaselion_service->GetExtensionIdsForTesting());
+  EXPECT_EQ(0, counter.loaded());
+  EXPECT_EQ(0, counter.unloaded());
+
+  // Only the rule that depends on auto-contribute is added, and the
+  // extensions of the other rules are neither unloaded nor loaded again.
+  greaselion_service->SetFeatureEnabled(greaselion::AUTO_CONTRIBUTION, true);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  auto new_extension_ids = greaselion_service->GetExtensionIdsForTesting();
+  EXPECT_EQ(extension_ids.size() + 1, new_extension_ids.size());
+  for (const auto& id : extension_ids)
+    EXPECT_TRUE(greaselion_service->IsGreaselionExtension(id));
+  EXPECT_EQ(1, counter.loaded());
+  EXPECT_EQ(0, counter.unloaded());
+
+  // Turning it back off removes only that rule again.
+  greaselion_service->SetFeatureEnabled(greaselion::AUTO_CONTRIBUTION, false);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  EXPECT_EQ(extension_ids, greaselion_service->GetExtensionIdsForTesting());
+  EXPECT_EQ(1, counter.loaded());
+  EXPECT_EQ(1, counter.unloaded());
+}
+
 IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsNotGreaselionExtension) {
   ASSERT_TRUE(InstallMockExtension());
 
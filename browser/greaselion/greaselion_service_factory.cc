@@ -9,13 +9,12 @@
 #include <string>
 
 #include "base/memory/singleton.h"
-#include "base/path_service.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "brave/components/greaselion/browser/greaselion_service_impl.h"
-#include "chrome/common/chrome_paths.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "content/public/browser/browser_context.h"
 #include "extensions/browser/extension_file_task_runner.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/extension_registry_factory.h"
@@ -54,9 +53,10 @@ KeyedService* GreaselionServiceFactory::BuildServiceInstanceFor(
   extension_system->InitForRegularProfile(true /* extensions_enabled */);
   extensions::ExtensionRegistry* extension_registry =
       extensions::ExtensionRegistry::Get(context);
-  base::FilePath install_directory;
-  base::PathService::Get(chrome::DIR_USER_DATA, &install_directory);
-  install_directory = install_directory.AppendASCII("Greaselion");
+  // Converted extensions are cached and pruned per profile, so keep them in
+  // the profile directory rather than sharing one cache across profiles.
+  base::FilePath install_directory =
+      context->GetPath().AppendASCII("Greaselion");
   scoped_refptr<base::SequencedTaskRunner> task_runner =
       extensions::GetExtensionFileTaskRunner();
   greaselion::GreaselionDownloadService* download_service = nullptr;
@@ -99,6 +99,27 @@ void BraveExternalProcessImporterClient::OnImportItemFinished(
   brave_profile_import_->ReportImportItemFinished(import_item);
 }
 
+// The brave importer sends history and favicons in several batches, and the
+// base client commits the rows it has collected as soon as a batch is
+// complete. Drop the rows of the previous batch when the next one starts so
+// that they are not committed again.
+void BraveExternalProcessImporterClient::OnHistoryImportStart(
+    uint32_t total_history_rows_count) {
+  if (ShouldUseBraveImporter(source_profile_.importer_type))
+    history_rows_.clear();
+
+  ExternalProcessImporterClient::OnHistoryImportStart(
+      total_history_rows_count);
+}
+
+void BraveExternalProcessImporterClient::OnFaviconsImportStart(
+    uint32_t total_favicons_count) {
+  if (ShouldUseBraveImporter(source_profile_.importer_type))
+    favicons_.clear();
+
+  ExternalProcessImporterClient::OnFaviconsImportStart(total_favicons_count);
+}
+
 void BraveExternalProcessImporterClient::OnCreditCardImportReady(
     const base::string16& name_on_card,
     const base::string16& expiration_month,
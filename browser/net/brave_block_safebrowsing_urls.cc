@@ -7,6 +7,9 @@
 
 #include <vector>
 
+#include "base/no_destructor.h"
+#include "base/stl_util.h"
+#include "brave/browser/net/url_rule_set.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
 #include "url/gurl.h"
@@ -15,34 +18,39 @@ namespace brave {
 
 const char kDummyUrl[] = "https://no-thanks.invalid";
 
+namespace {
+
+enum SafeBrowsingRule {
+  kAllowedRule,
+  kReportingRule,
+};
+
+}  // namespace
+
 bool IsSafeBrowsingReportingURL(const GURL& gurl) {
-  static const std::vector<URLPattern> allowed_patterns({
-      URLPattern(
-          URLPattern::SCHEME_HTTPS,
-          "https://sb-ssl.google.com/safebrowsing/clientreport/download*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/clientreport/"
-                 "crx-list-info*"),
-  });
-  static const std::vector<URLPattern> reporting_patterns({
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://sb-ssl.google.com/safebrowsing/clientreport/*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/clientreport/*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/report*"),
-      URLPattern(URLPattern::SCHEME_HTTPS,
-                 "https://safebrowsing.google.com/safebrowsing/uploads/*"),
-  });
-
-  if (std::any_of(
-          allowed_patterns.begin(), allowed_patterns.end(),
-          [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); })) {
-    return false;
-  }
-  return std::any_of(
-      reporting_patterns.begin(), reporting_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+  static const base::NoDestructor<URLRuleSet> rules([] {
+    URLRuleSet rules;
+    for (const char* allowed_pattern :
+         {"https://sb-ssl.google.com/safebrowsing/clientreport/download*",
+          "https://safebrowsing.google.com/safebrowsing/clientreport/"
+          "crx-list-info*"}) {
+      rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS, allowed_pattern),
+                    kAllowedRule);
+    }
+    for (const char* reporting_pattern :
+         {"https://sb-ssl.google.com/safebrowsing/clientreport/*",
+          "https://safebrowsing.google.com/safebrowsing/clientreport/*",
+          "https://safebrowsing.google.com/safebrowsing/report*",
+          "https://safebrowsing.google.com/safebrowsing/uploads/*"}) {
+      rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS, reporting_pattern),
+                    kReportingRule);
+    }
+    return rules;
+  }());
+
+  const std::vector<int> actions = rules->GetMatchingActions(gurl);
+  return !base::Contains(actions, kAllowedRule) &&
+         base::Contains(actions, kReportingRule);
 }
 
 int OnBeforeURLRequest_BlockSafeBrowsingReportingURLs(const GURL& request_url,
@@ -5,8 +5,10 @@
 
 #include "brave/browser/net/brave_referrals_network_delegate_helper.h"
 
+#include <vector>
+
 #include "base/values.h"
-#include "brave/components/brave_referrals/browser/brave_referrals_service.h"
+#include "brave/browser/net/url_rule_set.h"
 #include "brave/common/network_constants.h"
 #include "chrome/browser/browser_process.h"
 #include "content/public/browser/browser_thread.h"
@@ -15,17 +17,54 @@
 
 namespace brave {
 
+std::unique_ptr<URLRuleSet> CreateReferralHeadersRuleSet(
+    const base::ListValue& referral_headers_list) {
+  auto rules = std::make_unique<URLRuleSet>();
+  const auto& entries = referral_headers_list.GetList();
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const base::Value* domains_list =
+        entries[i].FindKeyOfType("domains", base::Value::Type::LIST);
+    if (!domains_list) {
+      LOG(WARNING) << "Failed to retrieve 'domains' key from referral headers";
+      continue;
+    }
+    if (!entries[i].FindKeyOfType("headers", base::Value::Type::DICTIONARY)) {
+      LOG(WARNING) << "Failed to retrieve 'headers' key from referral headers";
+      continue;
+    }
+    for (const auto& domain_value : domains_list->GetList()) {
+      URLPattern url_pattern(URLPattern::SCHEME_HTTPS |
+                             URLPattern::SCHEME_HTTP);
+      url_pattern.SetScheme("*");
+      url_pattern.SetHost(domain_value.GetString());
+      url_pattern.SetPath("/*");
+      url_pattern.SetMatchSubdomains(true);
+      rules->AddRule(url_pattern, static_cast<int>(i));
+    }
+  }
+  return rules;
+}
+
 int OnBeforeStartTransaction_ReferralsWork(
     net::HttpRequestHeaders* headers,
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
-  if (!ctx->referral_headers_list)
+  if (!ctx->referral_headers_list || !ctx->referral_headers_rules)
     return net::OK;
   // If the domain for this request matches one of our target domains,
-  // set the associated custom headers.
+  // set the associated custom headers. Rules are added in list order, so the
+  // first action is the first matching entry.
+  const std::vector<int> actions =
+      ctx->referral_headers_rules->GetMatchingActions(ctx->request_url);
+  if (actions.empty())
+    return net::OK;
+  const auto& entries = ctx->referral_headers_list->GetList();
+  if (static_cast<size_t>(actions.front()) >= entries.size())
+    return net::OK;
   const base::DictionaryValue* request_headers_dict = nullptr;
-  if (!BraveReferralsService::GetMatchingReferralHeaders(
-          *ctx->referral_headers_list, &request_headers_dict, ctx->request_url))
+  const base::Value* headers_dict = entries[actions.front()].FindKeyOfType(
+      "headers", base::Value::Type::DICTIONARY);
+  if (!headers_dict || !headers_dict->GetAsDictionary(&request_headers_dict))
     return net::OK;
   for (const auto& it : request_headers_dict->DictItems()) {
     if (it.first == kBravePartnerHeader) {
@@ -12,6 +12,10 @@
 
 struct BraveRequestInfo;
 
+namespace base {
+class ListValue;
+}
+
 namespace net {
 class HttpRequestHeaders;
 class URLRequest;
@@ -19,6 +23,13 @@ class URLRequest;
 
 namespace brave {
 
+class URLRuleSet;
+
+// Compiles the domains of |referral_headers_list| into a rule set whose
+// actions are indices of the matching entries in the list.
+std::unique_ptr<URLRuleSet> CreateReferralHeadersRuleSet(
+    const base::ListValue& referral_headers_list);
+
 int OnBeforeStartTransaction_ReferralsWork(
     net::HttpRequestHeaders* headers,
     const ResponseCallback& next_callback,
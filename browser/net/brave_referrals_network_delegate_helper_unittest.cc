@@ -10,6 +10,7 @@
 
 #include "base/json/json_reader.h"
 #include "brave/browser/net/url_context.h"
+#include "brave/browser/net/url_rule_set.h"
 #include "brave/common/network_constants.h"
 #include "net/base/net_errors.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -65,6 +66,9 @@ TEST(BraveReferralsNetworkDelegateHelperTest, ReplaceHeadersForMatchingDomain) {
   net::HttpRequestHeaders headers;
   auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
   request_info->referral_headers_list = referral_headers_list;
+  auto referral_headers_rules =
+      brave::CreateReferralHeadersRuleSet(*referral_headers_list);
+  request_info->referral_headers_rules = referral_headers_rules.get();
 
   int rc = brave::OnBeforeStartTransaction_ReferralsWork(
       &headers, brave::ResponseCallback(), request_info);
@@ -94,6 +98,9 @@ TEST(BraveReferralsNetworkDelegateHelperTest,
   net::HttpRequestHeaders headers;
   auto request_info = std::make_shared<brave::BraveRequestInfo>(GURL());
   request_info->referral_headers_list = referral_headers_list;
+  auto referral_headers_rules =
+      brave::CreateReferralHeadersRuleSet(*referral_headers_list);
+  request_info->referral_headers_rules = referral_headers_rules.get();
   int rc = brave::OnBeforeStartTransaction_ReferralsWork(
       &headers, brave::ResponseCallback(), request_info);
 
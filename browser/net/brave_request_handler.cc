@@ -17,6 +17,7 @@
 #include "brave/browser/net/brave_site_hacks_network_delegate_helper.h"
 #include "brave/browser/net/brave_stp_util.h"
 #include "brave/browser/net/global_privacy_control_network_delegate_helper.h"
+#include "brave/browser/net/url_rule_set.h"
 #include "brave/browser/translate/buildflags/buildflags.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
@@ -144,6 +145,10 @@ void BraveRequestHandler::OnReferralHeadersChanged() {
   if (const base::ListValue* referral_headers =
           g_browser_process->local_state()->GetList(kReferralHeaders)) {
     referral_headers_list_.reset(referral_headers->DeepCopy());
+#if BUILDFLAG(ENABLE_BRAVE_REFERRALS)
+    referral_headers_rules_ =
+        brave::CreateReferralHeadersRuleSet(*referral_headers_list_);
+#endif
   }
 }
 
@@ -177,6 +182,7 @@ int BraveRequestHandler::OnBeforeStartTransaction(
   ctx->event_type = brave::kOnBeforeStartTransaction;
   ctx->headers = headers;
   ctx->referral_headers_list = referral_headers_list_.get();
+  ctx->referral_headers_rules = referral_headers_rules_.get();
   callbacks_[ctx->request_identifier] = std::move(callback);
   RunNextCallback(ctx);
   return net::ERR_IO_PENDING;
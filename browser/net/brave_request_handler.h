@@ -65,6 +65,7 @@ class BraveRequestHandler {
   // PrefChangeRegistrar and corresponding |base::Unretained| usages, that are
   // illegal.
   std::unique_ptr<base::ListValue> referral_headers_list_;
+  std::unique_ptr<brave::URLRuleSet> referral_headers_rules_;
   std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
   std::unique_ptr<PrefChangeRegistrar, content::BrowserThread::DeleteOnUIThread>
       pref_change_registrar_;
@@ -9,10 +9,14 @@
 #include <string>
 #include <vector>
 
-#include "base/lazy_instance.h"
+#include "base/containers/flat_set.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
+#include "base/stl_util.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/url_rule_set.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/url_constants.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -22,25 +26,36 @@
 #include "net/url_request/url_request.h"
 #include "third_party/blink/public/common/loader/network_utils.h"
 #include "third_party/blink/public/common/loader/referrer_utils.h"
-#include "third_party/re2/src/re2/re2.h"
 
 namespace brave {
 
 namespace {
 
 bool IsUAWhitelisted(const GURL& gurl) {
-  static std::vector<URLPattern> whitelist_patterns(
-      {URLPattern(URLPattern::SCHEME_ALL, "https://*.duckduckgo.com/*"),
-       // For Widevine
-       URLPattern(URLPattern::SCHEME_ALL, "https://*.netflix.com/*")});
-  return std::any_of(
-      whitelist_patterns.begin(), whitelist_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+  static const base::NoDestructor<URLRuleSet> whitelist_rules([] {
+    URLRuleSet rules;
+    rules.AddRule(
+        URLPattern(URLPattern::SCHEME_ALL, "https://*.duckduckgo.com/*"), 0);
+    // For Widevine
+    rules.AddRule(URLPattern(URLPattern::SCHEME_ALL, "https://*.netflix.com/*"),
+                  0);
+    return rules;
+  }());
+  return whitelist_rules->Matches(gurl);
 }
 
-const std::string& GetQueryStringTrackers() {
-  static const base::NoDestructor<std::string> trackers(base::JoinString(
-      std::vector<std::string>(
+struct CaseInsensitiveLess {
+  bool operator()(base::StringPiece a, base::StringPiece b) const {
+    return base::CompareCaseInsensitiveASCII(a, b) < 0;
+  }
+};
+
+using QueryStringTrackers =
+    base::flat_set<base::StringPiece, CaseInsensitiveLess>;
+
+const QueryStringTrackers& GetQueryStringTrackers() {
+  static const base::NoDestructor<QueryStringTrackers> trackers(
+      std::vector<base::StringPiece>(
           {// https://github.com/brave/brave-browser/issues/4239
            "fbclid", "gclid", "msclkid", "mc_eid",
            // https://github.com/brave/brave-browser/issues/9879
@@ -58,40 +73,46 @@ const std::string& GetQueryStringTrackers() {
            // https://github.com/brave/brave-browser/issues/8975
            "__s",
            // https://github.com/brave/brave-browser/issues/9019
-           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}),
-      "|"));
+           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}));
   return *trackers;
 }
 
-// From src/components/autofill/content/renderer/page_passwords_analyser.cc
-// and password_form_conversion_utils.cc:
-#define DECLARE_LAZY_MATCHER(NAME, PATTERN)                                   \
-  struct LabelPatternLazyInstanceTraits_##NAME                                \
-      : public base::internal::DestructorAtExitLazyInstanceTraits<re2::RE2> { \
-    static re2::RE2* New(void* instance) {                                    \
-      re2::RE2::Options options;                                              \
-      options.set_case_sensitive(false);                                      \
-      re2::RE2* matcher = new (instance) re2::RE2(PATTERN, options);          \
-      DCHECK(matcher->ok());                                                  \
-      return matcher;                                                         \
-    }                                                                         \
-  };                                                                          \
-  base::LazyInstance<re2::RE2, LabelPatternLazyInstanceTraits_##NAME> NAME =  \
-      LAZY_INSTANCE_INITIALIZER
-
-// e.g. "?fbclid=1234"
-DECLARE_LAZY_MATCHER(tracker_only_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+$");
-
-// e.g. "?fbclid=1234&foo=1"
-DECLARE_LAZY_MATCHER(tracker_first_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+&");
-
-// e.g. "?foo=1&fbclid=1234" or "?foo=1&fbclid=1234&bar=2"
-DECLARE_LAZY_MATCHER(tracker_appended_matcher,
-                     "&(" + GetQueryStringTrackers() + ")=[^&]+");
-
-#undef DECLARE_LAZY_MATCHER
+// A parameter is a tracker when its name is in the list and it carries a
+// non-empty value, e.g. "fbclid=1234" but not "fbclid=" or "fbclid".
+bool IsTrackerParameter(base::StringPiece parameter) {
+  const size_t separator = parameter.find('=');
+  if (separator == base::StringPiece::npos ||
+      separator + 1 == parameter.size()) {
+    return false;
+  }
+  return base::Contains(GetQueryStringTrackers(),
+                        parameter.substr(0, separator));
+}
+
+// Removes tracker parameters from |query| in a single pass over its
+// '&'-separated parts. Returns false, leaving |new_query| untouched, when
+// there was nothing to remove.
+bool StripQueryStringTrackers(base::StringPiece query, std::string* new_query) {
+  std::vector<base::StringPiece> kept;
+  bool removed = false;
+  for (base::StringPiece parameter : base::SplitStringPiece(
+           query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL)) {
+    if (IsTrackerParameter(parameter)) {
+      removed = true;
+    } else {
+      kept.push_back(parameter);
+    }
+  }
+  if (!removed)
+    return false;
+
+  // Keep empty parts such as the one in "foo=1&&bar=2" as they were, but
+  // drop a query that is left with nothing but separators.
+  *new_query = base::JoinString(kept, "&");
+  if (new_query->find_first_not_of('&') == std::string::npos)
+    new_query->clear();
+  return true;
+}
 
 void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.SiteHacks.QueryFilter");
@@ -122,14 +143,8 @@ void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
     return;
   }
 
-  std::string new_query = ctx->request_url.query();
-  // Note: the ordering of these replacements is important.
-  const int replacement_count =
-      re2::RE2::GlobalReplace(&new_query, tracker_appended_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_first_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_only_matcher.Get(), "");
-
-  if (replacement_count > 0) {
+  std::string new_query;
+  if (StripQueryStringTrackers(ctx->request_url.query_piece(), &new_query)) {
     url::Replacements<char> replacements;
     if (new_query.empty()) {
       replacements.ClearQuery();
@@ -253,6 +253,11 @@ TEST(BraveSiteHacksNetworkDelegateHelperTest, QueryStringFiltered) {
           {"http://u:p@example.com/path/file.html?foo=1&fbclid=abcd#fragment",
            "http://u:p@example.com/path/file.html?foo=1#fragment"},
           {"https://example.com/?__s=1234-abcd", "https://example.com/"},
+          {"https://example.com/?FBCLID=1&foo=1&hsctatracking=2",
+           "https://example.com/?foo=1"},
+          {"https://example.com/?&fbclid=1&&gclid=2&", "https://example.com/"},
+          {"https://example.com/?foo=1&&fbclid=1&bar=2",
+           "https://example.com/?foo=1&&bar=2"},
           // Obscure edge cases that break most parsers:
           {"https://example.com/?fbclid&foo&&gclid=2&bar=&%20",
            "https://example.com/?fbclid&foo&&bar=&%20"},
@@ -10,7 +10,10 @@
 #include <string>
 #include <vector>
 
+#include "base/no_destructor.h"
+#include "base/stl_util.h"
 #include "base/strings/string_piece_forward.h"
+#include "brave/browser/net/url_rule_set.h"
 #include "brave/browser/translate/buildflags/buildflags.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/translate_network_constants.h"
@@ -31,6 +34,68 @@ base::StringPiece GetSafeBrowsingEndpoint() {
   return SAFEBROWSING_ENDPOINT;
 }
 
+enum StaticRedirectRule {
+  kGeoRule,
+  kSafeBrowsingRule,
+  kSafeBrowsingFileCheckRule,
+  kSafeBrowsingCrxListRule,
+  kCRXDownloadRule,
+  kAutofillRule,
+  kCRLSetRule,
+  kGvt1Rule,
+  kWidevineGvt1Rule,
+  kGoogleDlRule,
+  kWidevineGoogleDlRule,
+#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
+  kTranslateRule,
+  kTranslateLanguageRule,
+#endif
+};
+
+const URLRuleSet& GetStaticRedirectRules() {
+  static const base::NoDestructor<URLRuleSet> rules([] {
+    const int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+    URLRuleSet rules;
+    rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern),
+                  kGeoRule);
+    rules.AddHostRule(URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingPrefix),
+                      kSafeBrowsingRule);
+    rules.AddHostRule(
+        URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingFileCheckPrefix),
+        kSafeBrowsingFileCheckRule);
+    rules.AddHostRule(
+        URLPattern(URLPattern::SCHEME_HTTPS, kSafeBrowsingCrxListPrefix),
+        kSafeBrowsingCrxListRule);
+    rules.AddRule(URLPattern(kHttpOrHttps, kCRXDownloadPrefix),
+                  kCRXDownloadRule);
+    rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS, kAutofillPrefix),
+                  kAutofillRule);
+    // To-Do (@jumde) - Update the naming for the variables below
+    // https://github.com/brave/brave-browser/issues/10314
+    for (const char* crl_set_prefix :
+         {kCRLSetPrefix1, kCRLSetPrefix2, kCRLSetPrefix3, kCRLSetPrefix4}) {
+      rules.AddRule(URLPattern(kHttpOrHttps, crl_set_prefix), kCRLSetRule);
+    }
+    rules.AddRule(URLPattern(kHttpOrHttps, "*://*.gvt1.com/*"), kGvt1Rule);
+    rules.AddRule(URLPattern(kHttpOrHttps, kWidevineGvt1Prefix),
+                  kWidevineGvt1Rule);
+    rules.AddRule(URLPattern(kHttpOrHttps, "*://dl.google.com/*"),
+                  kGoogleDlRule);
+    rules.AddRule(URLPattern(kHttpOrHttps, kWidevineGoogleDlPrefix),
+                  kWidevineGoogleDlRule);
+#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
+    rules.AddRule(
+        URLPattern(URLPattern::SCHEME_HTTPS, kTranslateElementJSPattern),
+        kTranslateRule);
+    rules.AddRule(
+        URLPattern(URLPattern::SCHEME_HTTPS, kTranslateLanguagePattern),
+        kTranslateLanguageRule);
+#endif
+    return rules;
+  }());
+  return *rules;
+}
+
 }  // namespace
 
 void SetSafeBrowsingEndpointForTesting(bool testing) {
@@ -53,126 +118,67 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
   GURL::Replacements replacements;
-  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
-  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingPrefix);
-  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
-                                                  kSafeBrowsingFileCheckPrefix);
-  static URLPattern safebrowsingcrxlist_pattern(URLPattern::SCHEME_HTTPS,
-                                                kSafeBrowsingCrxListPrefix);
-
-  // To-Do (@jumde) - Update the naming for the variables below
-  // https://github.com/brave/brave-browser/issues/10314
-  static URLPattern crlSet_pattern1(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix1);
-  static URLPattern crlSet_pattern2(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix2);
-  static URLPattern crlSet_pattern3(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix3);
-  static URLPattern crlSet_pattern4(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix4);
-  static URLPattern crxDownload_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRXDownloadPrefix);
-  static URLPattern autofill_pattern(
-      URLPattern::SCHEME_HTTPS, kAutofillPrefix);
-  static URLPattern gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, "*://*.gvt1.com/*");
-  static URLPattern googleDl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://dl.google.com/*");
-
-  static URLPattern widevine_gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGvt1Prefix);
-  static URLPattern widevine_google_dl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGoogleDlPrefix);
+  const std::vector<int> actions =
+      GetStaticRedirectRules().GetMatchingActions(request_url);
+  if (actions.empty())
+    return net::OK;
+  auto matches = [&actions](StaticRedirectRule rule) {
+    return base::Contains(actions, rule);
+  };
 
-#if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  static URLPattern translate_pattern(URLPattern::SCHEME_HTTPS,
-      kTranslateElementJSPattern);
-  static URLPattern translate_language_pattern(URLPattern::SCHEME_HTTPS,
-      kTranslateLanguagePattern);
-#endif
-  if (geo_pattern.MatchesURL(request_url)) {
+  if (matches(kGeoRule)) {
     *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
     return net::OK;
   }
 
   auto safebrowsing_endpoint = GetSafeBrowsingEndpoint();
-  if (!safebrowsing_endpoint.empty() &&
-      safeBrowsing_pattern.MatchesHost(request_url)) {
+  if (!safebrowsing_endpoint.empty() && matches(kSafeBrowsingRule)) {
     replacements.SetHostStr(safebrowsing_endpoint);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
+  if (!safebrowsing_endpoint.empty() && matches(kSafeBrowsingFileCheckRule)) {
     replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingcrxlist_pattern.MatchesHost(request_url)) {
+  if (!safebrowsing_endpoint.empty() && matches(kSafeBrowsingCrxListRule)) {
     replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crxDownload_pattern.MatchesURL(request_url)) {
+  if (matches(kCRXDownloadRule)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crxdownload.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (autofill_pattern.MatchesURL(request_url)) {
+  if (matches(kAutofillRule)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveStaticProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (crlSet_pattern1.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern2.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern3.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern4.MatchesURL(request_url)) {
+  if (matches(kCRLSetRule)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr("crlsets.brave.com");
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (gvt1_pattern.MatchesURL(request_url) &&
-      !widevine_gvt1_pattern.MatchesURL(request_url)) {
+  if (matches(kGvt1Rule) && !matches(kWidevineGvt1Rule)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveRedirectorProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (googleDl_pattern.MatchesURL(request_url) &&
-      !widevine_google_dl_pattern.MatchesURL(request_url)) {
+  if (matches(kGoogleDlRule) && !matches(kWidevineGoogleDlRule)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveRedirectorProxy);
     *new_url = request_url.ReplaceComponents(replacements);
@@ -180,7 +186,7 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
   }
 
 #if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  if (translate_pattern.MatchesURL(request_url)) {
+  if (matches(kTranslateRule)) {
     replacements.SetQueryStr(request_url.query_piece());
     replacements.SetPathStr(request_url.path_piece());
     *new_url =
@@ -188,7 +194,7 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     return net::OK;
   }
 
-  if (translate_language_pattern.MatchesURL(request_url)) {
+  if (matches(kTranslateLanguageRule)) {
     *new_url = GURL(kBraveTranslateLanguageEndpoint);
     return net::OK;
   }
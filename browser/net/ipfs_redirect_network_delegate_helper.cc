@@ -7,11 +7,41 @@
 
 #include <string>
 
+#include "base/feature_list.h"
+#include "brave/browser/ipfs/ipfs_service_factory.h"
+#include "brave/components/ipfs/features.h"
+#include "brave/components/ipfs/ipfs_service.h"
 #include "brave/components/ipfs/ipfs_utils.h"
 #include "net/base/net_errors.h"
 
 namespace ipfs {
 
+namespace {
+
+void OnGatewayRaceComplete(const brave::ResponseCallback& next_callback,
+                           std::shared_ptr<brave::BraveRequestInfo> ctx,
+                           const GURL& gateway) {
+  GURL new_url;
+  if (TranslateIPFSURI(ctx->request_url, &new_url,
+                       gateway.is_empty() ? ctx->ipfs_gateway_url : gateway,
+                       false)) {
+    ctx->new_url_spec = new_url.spec();
+  }
+  next_callback.Run();
+}
+
+// Top-level ipfs:// navigations with a local node configured can race the
+// local node against the public gateway, since the local node is slow to
+// serve content it doesn't have yet.
+bool ShouldRaceGateways(std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  return base::FeatureList::IsEnabled(features::kIpfsGatewayRace) &&
+         ctx->resource_type == blink::mojom::ResourceType::kMainFrame &&
+         IsIPFSScheme(ctx->request_url) &&
+         IsLocalGatewayConfigured(ctx->browser_context);
+}
+
+}  // namespace
+
 int OnBeforeURLRequest_IPFSRedirectWork(
     const brave::ResponseCallback& next_callback,
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
@@ -20,6 +50,17 @@ int OnBeforeURLRequest_IPFSRedirectWork(
     return net::OK;
   }
 
+  if (ShouldRaceGateways(ctx)) {
+    auto* service = IpfsServiceFactory::GetForContext(ctx->browser_context);
+    if (service && service->IsDaemonLaunched()) {
+      service->RaceGateways(
+          ctx->request_url, ctx->ipfs_gateway_url,
+          GetDefaultIPFSGateway(ctx->browser_context),
+          base::BindOnce(&OnGatewayRaceComplete, next_callback, ctx));
+      return net::ERR_IO_PENDING;
+    }
+  }
+
   GURL new_url;
   if (ipfs::TranslateIPFSURI(ctx->request_url, &new_url, ctx->ipfs_gateway_url,
                              false)) {
@@ -29,6 +29,7 @@ struct ResourceRequest;
 
 namespace brave {
 struct BraveRequestInfo;
+class URLRuleSet;
 using ResponseCallback = base::Callback<void()>;
 }  // namespace brave
 
@@ -96,6 +97,8 @@ struct BraveRequestInfo {
   GURL* allowed_unsafe_redirect_url = nullptr;
   BraveNetworkDelegateEventType event_type = kUnknownEventType;
   const base::ListValue* referral_headers_list = nullptr;
+  // |referral_headers_list| compiled by CreateReferralHeadersRuleSet().
+  const URLRuleSet* referral_headers_rules = nullptr;
   BlockedBy blocked_by = kNotBlocked;
   std::string mock_data_url;
   GURL ipfs_gateway_url;
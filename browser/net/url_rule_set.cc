@@ -0,0 +1,88 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_rule_set.h"
+
+#include <algorithm>
+
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+URLRuleSet::URLRuleSet() = default;
+
+URLRuleSet::~URLRuleSet() = default;
+
+void URLRuleSet::AddRule(const URLPattern& pattern, int action) {
+  Add(pattern, action, false);
+}
+
+void URLRuleSet::AddHostRule(const URLPattern& pattern, int action) {
+  Add(pattern, action, true);
+}
+
+void URLRuleSet::Add(const URLPattern& pattern, int action, bool host_only) {
+  const size_t index = rules_.size();
+  rules_.push_back({pattern, action, host_only});
+  if (pattern.host().empty())
+    any_host_rules_.push_back(index);
+  else
+    rules_by_host_[pattern.host()].push_back(index);
+}
+
+std::vector<int> URLRuleSet::GetMatchingActions(const GURL& url) const {
+  std::vector<int> actions;
+  for (size_t index : GetMatchingRules(url))
+    actions.push_back(rules_[index].action);
+  return actions;
+}
+
+bool URLRuleSet::Matches(const GURL& url) const {
+  return !GetMatchingRules(url).empty();
+}
+
+void URLRuleSet::CollectMatches(const std::vector<size_t>& candidates,
+                                const GURL& url,
+                                std::vector<size_t>* matches) const {
+  for (size_t index : candidates) {
+    const Rule& rule = rules_[index];
+    if (rule.host_only ? rule.pattern.MatchesHost(url)
+                       : rule.pattern.MatchesURL(url)) {
+      matches->push_back(index);
+    }
+  }
+}
+
+std::vector<size_t> URLRuleSet::GetMatchingRules(const GURL& url) const {
+  std::vector<size_t> matches;
+  if (rules_.empty() || !url.is_valid())
+    return matches;
+
+  CollectMatches(any_host_rules_, url, &matches);
+
+  // Walk "a.b.example.com", "b.example.com", "example.com" and "com". The
+  // candidate patterns still do the exact scheme, subdomain and path checks.
+  // URLPattern ignores a trailing dot on the host, so "example.com." must
+  // reach the "example.com" rules as well.
+  base::StringPiece host = url.host_piece();
+  if (base::EndsWith(host, "."))
+    host.remove_suffix(1);
+  while (!host.empty()) {
+    auto it = rules_by_host_.find(host);
+    if (it != rules_by_host_.end())
+      CollectMatches(it->second, url, &matches);
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    host.remove_prefix(dot + 1);
+  }
+
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+}  // namespace brave
@@ -0,0 +1,68 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_URL_RULE_SET_H_
+#define BRAVE_BROWSER_NET_URL_RULE_SET_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "extensions/common/url_pattern.h"
+
+class GURL;
+
+namespace brave {
+
+// A set of URLPatterns, each tagged with an action, that is matched against a
+// request with a single lookup. Rules are bucketed by the host of their
+// pattern so that a request only evaluates the patterns registered for one of
+// its host suffixes, plus any that match every host.
+class URLRuleSet {
+ public:
+  URLRuleSet();
+  ~URLRuleSet();
+
+  URLRuleSet(const URLRuleSet&) = delete;
+  URLRuleSet& operator=(const URLRuleSet&) = delete;
+
+  // Adds a rule that fires when |pattern| matches the whole URL.
+  void AddRule(const URLPattern& pattern, int action);
+  // Adds a rule that fires when the URL's scheme and host match |pattern|,
+  // regardless of its path.
+  void AddHostRule(const URLPattern& pattern, int action);
+
+  // Returns the actions of all rules matching |url|, in the order the rules
+  // were added.
+  std::vector<int> GetMatchingActions(const GURL& url) const;
+  bool Matches(const GURL& url) const;
+
+  bool empty() const { return rules_.empty(); }
+
+ private:
+  struct Rule {
+    URLPattern pattern;
+    int action;
+    bool host_only;
+  };
+
+  void Add(const URLPattern& pattern, int action, bool host_only);
+  void CollectMatches(const std::vector<size_t>& candidates,
+                      const GURL& url,
+                      std::vector<size_t>* matches) const;
+  std::vector<size_t> GetMatchingRules(const GURL& url) const;
+
+  std::vector<Rule> rules_;
+  // Indices into |rules_| keyed by pattern host.
+  base::flat_map<std::string, std::vector<size_t>, std::less<>>
+      rules_by_host_;
+  // Indices of rules whose pattern matches all hosts.
+  std::vector<size_t> any_host_rules_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_URL_RULE_SET_H_
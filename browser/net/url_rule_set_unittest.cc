@@ -0,0 +1,68 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_rule_set.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+TEST(URLRuleSetTest, MatchesHostSuffixes) {
+  URLRuleSet rules;
+  rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS, "https://*.gvt1.com/*"),
+                1);
+  rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS,
+                           "https://dl.google.com/widevine-cdm/*"),
+                2);
+  rules.AddRule(URLPattern(URLPattern::SCHEME_ALL, "*://*/*"), 3);
+
+  EXPECT_EQ(std::vector<int>({1, 3}),
+            rules.GetMatchingActions(GURL("https://redirector.gvt1.com/x")));
+  EXPECT_EQ(std::vector<int>({1, 3}),
+            rules.GetMatchingActions(GURL("https://gvt1.com/x")));
+  // Scheme and path are still checked by the pattern.
+  EXPECT_EQ(std::vector<int>({3}),
+            rules.GetMatchingActions(GURL("http://redirector.gvt1.com/x")));
+  EXPECT_EQ(std::vector<int>({2, 3}),
+            rules.GetMatchingActions(
+                GURL("https://dl.google.com/widevine-cdm/1.zip")));
+  EXPECT_EQ(std::vector<int>({3}), rules.GetMatchingActions(
+                                       GURL("https://dl.google.com/other")));
+  // An exact host pattern doesn't match subdomains.
+  EXPECT_EQ(std::vector<int>({3}),
+            rules.GetMatchingActions(
+                GURL("https://a.dl.google.com/widevine-cdm/1.zip")));
+  EXPECT_TRUE(rules.GetMatchingActions(GURL()).empty());
+}
+
+TEST(URLRuleSetTest, HostRules) {
+  URLRuleSet rules;
+  rules.AddHostRule(URLPattern(URLPattern::SCHEME_HTTPS,
+                               "https://safebrowsing.googleapis.com/"),
+                    1);
+  EXPECT_TRUE(rules.Matches(
+      GURL("https://safebrowsing.googleapis.com/v4/threatListUpdates")));
+  EXPECT_FALSE(rules.Matches(GURL("https://googleapis.com/v4")));
+}
+
+TEST(URLRuleSetTest, IgnoresTrailingDotInHost) {
+  URLRuleSet rules;
+  rules.AddHostRule(URLPattern(URLPattern::SCHEME_HTTPS,
+                               "https://safebrowsing.googleapis.com/"),
+                    1);
+  rules.AddRule(URLPattern(URLPattern::SCHEME_HTTPS, "https://*.gvt1.com/*"),
+                2);
+  EXPECT_EQ(std::vector<int>({1}),
+            rules.GetMatchingActions(
+                GURL("https://safebrowsing.googleapis.com./v4/fullHashes")));
+  EXPECT_EQ(std::vector<int>({2}),
+            rules.GetMatchingActions(GURL("https://redirector.gvt1.com./x")));
+  EXPECT_FALSE(rules.Matches(GURL("https://googleapis.com./v4")));
+}
+
+}  // namespace brave
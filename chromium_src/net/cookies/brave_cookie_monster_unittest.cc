@@ -0,0 +1,166 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "net/cookies/cookie_monster.h"
+
+#include <memory>
+#include <set>
+#include <string>
+
+#include "base/strings/stringprintf.h"
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "net/cookies/canonical_cookie.h"
+#include "net/cookies/cookie_deletion_info.h"
+#include "net/cookies/cookie_options.h"
+#include "net/cookies/cookie_store_test_callbacks.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace net {
+
+namespace {
+
+constexpr int kTopFrameCount = 500;
+
+GURL GetTopFrameURL(int index) {
+  return GURL(base::StringPrintf("https://site%d.com/", index));
+}
+
+}  // namespace
+
+class BraveCookieMonsterTest : public testing::Test {
+ public:
+  BraveCookieMonsterTest()
+      : cookie_monster_(nullptr /* store */, nullptr /* net_log */) {}
+
+ protected:
+  void SetEphemeralCookie(const GURL& url,
+                          const std::string& cookie_line,
+                          const GURL& top_frame_url) {
+    cookie_monster_.SetEphemeralCanonicalCookieAsync(
+        CanonicalCookie::Create(url, cookie_line, base::Time::Now(),
+                                base::nullopt),
+        url, top_frame_url, CookieOptions::MakeAllInclusive(),
+        CookieStore::SetCookiesCallback());
+  }
+
+  CookieList GetEphemeralCookies(const GURL& url, const GURL& top_frame_url) {
+    GetCookieListCallback callback;
+    cookie_monster_.GetEphemeralCookieListWithOptionsAsync(
+        url, top_frame_url, CookieOptions::MakeAllInclusive(),
+        callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.cookies();
+  }
+
+  void DeleteAllMatchingInfo(CookieDeletionInfo delete_info) {
+    ResultSavingCookieCallback<uint32_t> callback;
+    cookie_monster_.DeleteAllMatchingInfoAsync(std::move(delete_info),
+                                               callback.MakeCallback());
+    callback.WaitUntilDone();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  CookieMonster cookie_monster_;
+};
+
+TEST_F(BraveCookieMonsterTest, ReadingDoesNotCreateEphemeralStores) {
+  const GURL url("https://tracker.com/");
+
+  for (int i = 0; i < kTopFrameCount; ++i)
+    EXPECT_TRUE(GetEphemeralCookies(url, GetTopFrameURL(i)).empty());
+
+  EXPECT_EQ(0u, cookie_monster_.GetEphemeralCookieStoreCountForTesting());
+}
+
+TEST_F(BraveCookieMonsterTest, KeepsOneEphemeralStorePerTopFrameDomain) {
+  const GURL url("https://tracker.com/");
+
+  for (int i = 0; i < kTopFrameCount; ++i) {
+    SetEphemeralCookie(url, base::StringPrintf("id=%d", i), GetTopFrameURL(i));
+    // A second frame from the same site shares the store.
+    SetEphemeralCookie(url, "seen=1",
+                       GURL(base::StringPrintf("https://www.site%d.com/", i)));
+  }
+
+  EXPECT_EQ(static_cast<size_t>(kTopFrameCount),
+            cookie_monster_.GetEphemeralCookieStoreCountForTesting());
+  for (int i = 0; i < kTopFrameCount; ++i) {
+    CookieList cookies = GetEphemeralCookies(url, GetTopFrameURL(i));
+    ASSERT_EQ(2u, cookies.size());
+    const std::string expected_id = base::StringPrintf("%d", i);
+    EXPECT_TRUE(cookies[0].Value() == expected_id ||
+                cookies[1].Value() == expected_id);
+  }
+}
+
+TEST_F(BraveCookieMonsterTest, DeletesMatchingCookiesFromEphemeralStores) {
+  const GURL tracker_url("https://tracker.com/");
+  const GURL widget_url("https://widget.com/");
+
+  for (int i = 0; i < kTopFrameCount; ++i) {
+    SetEphemeralCookie(widget_url, "a=1", GetTopFrameURL(i));
+    if (i % 2 == 0)
+      SetEphemeralCookie(tracker_url, "b=1", GetTopFrameURL(i));
+  }
+
+  CookieDeletionInfo delete_info;
+  delete_info.domains_and_ips_to_delete = std::set<std::string>{"tracker.com"};
+  DeleteAllMatchingInfo(std::move(delete_info));
+
+  EXPECT_EQ(static_cast<size_t>(kTopFrameCount),
+            cookie_monster_.GetEphemeralCookieStoreCountForTesting());
+  for (int i = 0; i < kTopFrameCount; ++i) {
+    EXPECT_TRUE(GetEphemeralCookies(tracker_url, GetTopFrameURL(i)).empty());
+    EXPECT_EQ(1u, GetEphemeralCookies(widget_url, GetTopFrameURL(i)).size());
+  }
+}
+
+TEST_F(BraveCookieMonsterTest, DeletesCanonicalCookieFromEphemeralStores) {
+  const GURL url("https://tracker.com/");
+
+  for (int i = 0; i < kTopFrameCount; ++i)
+    SetEphemeralCookie(url, "a=1", GetTopFrameURL(i));
+
+  const CookieList cookies = GetEphemeralCookies(url, GetTopFrameURL(0));
+  ASSERT_EQ(1u, cookies.size());
+  ResultSavingCookieCallback<uint32_t> callback;
+  cookie_monster_.DeleteCanonicalCookieAsync(cookies[0],
+                                             callback.MakeCallback());
+  callback.WaitUntilDone();
+
+  EXPECT_TRUE(GetEphemeralCookies(url, GetTopFrameURL(0)).empty());
+  EXPECT_EQ(static_cast<size_t>(kTopFrameCount),
+            cookie_monster_.GetEphemeralCookieStoreCountForTesting());
+}
+
+TEST_F(BraveCookieMonsterTest, ErasesEphemeralStoreForStorageDomain) {
+  const GURL url("https://tracker.com/");
+
+  for (int i = 0; i < kTopFrameCount; ++i)
+    SetEphemeralCookie(url, "a=1", GetTopFrameURL(i));
+
+  for (int i = 0; i < kTopFrameCount; i += 2) {
+    CookieDeletionInfo delete_info;
+    delete_info.ephemeral_storage_domain =
+        base::StringPrintf("site%d.com", i);
+    DeleteAllMatchingInfo(std::move(delete_info));
+  }
+
+  EXPECT_EQ(static_cast<size_t>(kTopFrameCount / 2),
+            cookie_monster_.GetEphemeralCookieStoreCountForTesting());
+  EXPECT_TRUE(GetEphemeralCookies(url, GetTopFrameURL(0)).empty());
+  EXPECT_EQ(1u, GetEphemeralCookies(url, GetTopFrameURL(1)).size());
+
+  // Erased stores are not recreated by later deletions.
+  CookieDeletionInfo delete_info;
+  delete_info.host = std::string("tracker.com");
+  DeleteAllMatchingInfo(std::move(delete_info));
+  EXPECT_EQ(static_cast<size_t>(kTopFrameCount / 2),
+            cookie_monster_.GetEphemeralCookieStoreCountForTesting());
+}
+
+}  // namespace net
@@ -6,6 +6,8 @@
 #include "net/cookies/cookie_monster.h"
 
 #include <memory>
+#include <set>
+
 #include "net/base/url_util.h"
 
 #define CookieMonster ChromiumCookieMonster
@@ -18,14 +20,16 @@ CookieMonster::CookieMonster(scoped_refptr<PersistentCookieStore> store,
                              NetLog* net_log)
     : ChromiumCookieMonster(store, net_log),
       net_log_(
-          NetLogWithSource::Make(net_log, NetLogSourceType::COOKIE_STORE)) {}
+          NetLogWithSource::Make(net_log, NetLogSourceType::COOKIE_STORE)),
+      empty_ephemeral_cookie_store_(nullptr /* store */, net_log) {}
 
 CookieMonster::CookieMonster(scoped_refptr<PersistentCookieStore> store,
                              base::TimeDelta last_access_threshold,
                              NetLog* net_log)
     : ChromiumCookieMonster(store, last_access_threshold, net_log),
       net_log_(
-          NetLogWithSource::Make(net_log, NetLogSourceType::COOKIE_STORE)) {}
+          NetLogWithSource::Make(net_log, NetLogSourceType::COOKIE_STORE)),
+      empty_ephemeral_cookie_store_(nullptr /* store */, net_log) {}
 
 CookieMonster::~CookieMonster() {}
 
@@ -37,16 +41,85 @@ CookieMonster::GetOrCreateEphemeralCookieStoreForTopFrameURL(
   if (it != ephemeral_cookie_stores_.end())
     return it->second.get();
 
-  return ephemeral_cookie_stores_
-      .emplace(domain, new ChromiumCookieMonster(nullptr /* store */,
-                                                 net_log_.net_log()))
-      .first->second.get();
+  ChromiumCookieMonster* ephemeral_monster =
+      ephemeral_cookie_stores_
+          .emplace(domain, new ChromiumCookieMonster(nullptr /* store */,
+                                                     net_log_.net_log()))
+          .first->second.get();
+  // Cookieable schemes can only be changed before a store is first used, so
+  // they are applied here rather than to stores which already exist.
+  if (cookieable_schemes_) {
+    ephemeral_monster->SetCookieableSchemes(*cookieable_schemes_,
+                                            SetCookieableSchemesCallback());
+  }
+  return ephemeral_monster;
+}
+
+void CookieMonster::EraseEphemeralCookieStore(
+    const std::string& ephemeral_storage_domain) {
+  if (!ephemeral_cookie_stores_.erase(ephemeral_storage_domain))
+    return;
+
+  for (auto it = ephemeral_storage_domains_by_cookie_key_.begin();
+       it != ephemeral_storage_domains_by_cookie_key_.end();) {
+    it->second.erase(ephemeral_storage_domain);
+    if (it->second.empty())
+      it = ephemeral_storage_domains_by_cookie_key_.erase(it);
+    else
+      ++it;
+  }
+}
+
+std::vector<ChromiumCookieMonster*>
+CookieMonster::GetEphemeralCookieStoresForDeletion(
+    const CookieDeletionInfo& delete_info) {
+  std::set<std::string> cookie_keys;
+  if (delete_info.url && !delete_info.url->host().empty()) {
+    cookie_keys.insert(GetKey(delete_info.url->host()));
+  } else if (delete_info.host && !delete_info.host->empty()) {
+    cookie_keys.insert(GetKey(*delete_info.host));
+  } else if (delete_info.domains_and_ips_to_delete) {
+    for (const auto& domain : *delete_info.domains_and_ips_to_delete)
+      cookie_keys.insert(GetKey(domain));
+  }
+
+  std::vector<ChromiumCookieMonster*> ephemeral_monsters;
+  if (cookie_keys.empty() && !delete_info.domains_and_ips_to_delete) {
+    for (auto& it : ephemeral_cookie_stores_)
+      ephemeral_monsters.push_back(it.second.get());
+    return ephemeral_monsters;
+  }
+
+  std::set<std::string> ephemeral_storage_domains;
+  for (const auto& cookie_key : cookie_keys) {
+    auto it = ephemeral_storage_domains_by_cookie_key_.find(cookie_key);
+    if (it == ephemeral_storage_domains_by_cookie_key_.end())
+      continue;
+    ephemeral_storage_domains.insert(it->second.begin(), it->second.end());
+  }
+  for (const auto& domain : ephemeral_storage_domains) {
+    auto it = ephemeral_cookie_stores_.find(domain);
+    if (it != ephemeral_cookie_stores_.end())
+      ephemeral_monsters.push_back(it->second.get());
+  }
+  return ephemeral_monsters;
+}
+
+size_t CookieMonster::GetEphemeralCookieStoreCountForTesting() const {
+  return ephemeral_cookie_stores_.size();
 }
 
 void CookieMonster::DeleteCanonicalCookieAsync(const CanonicalCookie& cookie,
                                                DeleteCallback callback) {
-  for (auto& it : ephemeral_cookie_stores_) {
-    it.second->DeleteCanonicalCookieAsync(cookie, DeleteCallback());
+  auto it = ephemeral_storage_domains_by_cookie_key_.find(
+      GetKey(cookie.Domain()));
+  if (it != ephemeral_storage_domains_by_cookie_key_.end()) {
+    for (const auto& domain : it->second) {
+      auto store_it = ephemeral_cookie_stores_.find(domain);
+      if (store_it == ephemeral_cookie_stores_.end())
+        continue;
+      store_it->second->DeleteCanonicalCookieAsync(cookie, DeleteCallback());
+    }
   }
   ChromiumCookieMonster::DeleteCanonicalCookieAsync(cookie,
                                                     std::move(callback));
@@ -66,13 +139,15 @@ void CookieMonster::DeleteAllCreatedInTimeRangeAsync(
 void CookieMonster::DeleteAllMatchingInfoAsync(CookieDeletionInfo delete_info,
                                                DeleteCallback callback) {
   if (delete_info.ephemeral_storage_domain.has_value()) {
-    ephemeral_cookie_stores_.erase(*delete_info.ephemeral_storage_domain);
+    EraseEphemeralCookieStore(*delete_info.ephemeral_storage_domain);
     std::move(callback).Run(0);
     return;
   }
 
-  for (auto& it : ephemeral_cookie_stores_) {
-    it.second->DeleteAllMatchingInfoAsync(delete_info, DeleteCallback());
+  for (auto* ephemeral_monster :
+       GetEphemeralCookieStoresForDeletion(delete_info)) {
+    ephemeral_monster->DeleteAllMatchingInfoAsync(delete_info,
+                                                  DeleteCallback());
   }
   ChromiumCookieMonster::DeleteAllMatchingInfoAsync(delete_info,
                                                     std::move(callback));
@@ -88,9 +163,7 @@ void CookieMonster::DeleteSessionCookiesAsync(DeleteCallback callback) {
 void CookieMonster::SetCookieableSchemes(
     const std::vector<std::string>& schemes,
     SetCookieableSchemesCallback callback) {
-  for (auto& it : ephemeral_cookie_stores_) {
-    it.second->SetCookieableSchemes(schemes, SetCookieableSchemesCallback());
-  }
+  cookieable_schemes_ = schemes;
   ChromiumCookieMonster::SetCookieableSchemes(schemes, std::move(callback));
 }
 
@@ -99,8 +172,13 @@ void CookieMonster::GetEphemeralCookieListWithOptionsAsync(
     const GURL& top_frame_url,
     const CookieOptions& options,
     GetCookieListCallback callback) {
+  // Reading must not create a store, otherwise every third-party frame would
+  // leave an empty one behind.
+  auto it =
+      ephemeral_cookie_stores_.find(URLToEphemeralStorageDomain(top_frame_url));
   ChromiumCookieMonster* ephemeral_monster =
-      GetOrCreateEphemeralCookieStoreForTopFrameURL(top_frame_url);
+      it != ephemeral_cookie_stores_.end() ? it->second.get()
+                                           : &empty_ephemeral_cookie_store_;
   ephemeral_monster->GetCookieListWithOptionsAsync(url, options,
                                                    std::move(callback));
 }
@@ -111,6 +189,10 @@ void CookieMonster::SetEphemeralCanonicalCookieAsync(
     const GURL& top_frame_url,
     const CookieOptions& options,
     SetCookiesCallback callback) {
+  if (cookie) {
+    ephemeral_storage_domains_by_cookie_key_[GetKey(cookie->Domain())].insert(
+        URLToEphemeralStorageDomain(top_frame_url));
+  }
   ChromiumCookieMonster* ephemeral_monster =
       GetOrCreateEphemeralCookieStoreForTopFrameURL(top_frame_url);
   ephemeral_monster->SetCanonicalCookieAsync(std::move(cookie), source_url,
@@ -6,6 +6,8 @@
 #ifndef BRAVE_CHROMIUM_SRC_NET_COOKIES_COOKIE_MONSTER_H_
 #define BRAVE_CHROMIUM_SRC_NET_COOKIES_COOKIE_MONSTER_H_
 
+#include <set>
+
 #define CookieMonster ChromiumCookieMonster
 #include "../../../../net/cookies/cookie_monster.h"
 #undef CookieMonster
@@ -47,12 +49,31 @@ class NET_EXPORT CookieMonster : public ChromiumCookieMonster {
                                         const CookieOptions& options,
                                         SetCookiesCallback callback);
 
+  size_t GetEphemeralCookieStoreCountForTesting() const;
+
  private:
+  // Returns the ephemeral stores which may hold cookies matching
+  // |delete_info|, or all of them if that cannot be narrowed down.
+  std::vector<ChromiumCookieMonster*> GetEphemeralCookieStoresForDeletion(
+      const CookieDeletionInfo& delete_info);
+  ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
+      const GURL& top_frame_url);
+  void EraseEphemeralCookieStore(const std::string& ephemeral_storage_domain);
+
   NetLogWithSource net_log_;
+  // Ephemeral stores keyed by the top frame's ephemeral storage domain. A
+  // store is only created once a cookie is set in it, and is erased when the
+  // last top-level frame for its domain goes away.
   std::map<std::string, std::unique_ptr<ChromiumCookieMonster>>
       ephemeral_cookie_stores_;
-  ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
-      const GURL& top_frame_url);
+  // Ephemeral storage domains which have had cookies set for each cookie key
+  // (see CookieMonster::GetKey), so deleting cookies for a domain only visits
+  // the stores that may hold them.
+  std::map<std::string, std::set<std::string>>
+      ephemeral_storage_domains_by_cookie_key_;
+  // Always empty; serves reads for domains which have no store yet.
+  ChromiumCookieMonster empty_ephemeral_cookie_store_;
+  base::Optional<std::vector<std::string>> cookieable_schemes_;
 };
 
 }  // namespace net
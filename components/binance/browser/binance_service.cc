@@ -22,6 +22,7 @@
 #include "brave/common/pref_names.h"
 #include "brave/components/binance/browser/binance_json_parser.h"
 #include "brave/components/binance/browser/regions.h"
+#include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_cache.h"
 #include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_oauth.h"
 #include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_region.h"
 #include "components/country_codes/country_codes.h"
@@ -46,6 +47,14 @@ const char oauth_scope[] =
 const char oauth_url[] = "https://accounts.binance.com/en/oauth/authorize";
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// How long responses are served from memory, and for how much longer they
+// are served while being refreshed.
+constexpr base::TimeDelta kAccountBalancesTTL =
+    base::TimeDelta::FromSeconds(30);
+constexpr base::TimeDelta kConvertAssetsTTL = base::TimeDelta::FromHours(1);
+constexpr base::TimeDelta kCoinNetworksTTL = base::TimeDelta::FromHours(1);
+constexpr base::TimeDelta kMaxStale = base::TimeDelta::FromMinutes(10);
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("binance_service", R"(
       semantics {
@@ -83,6 +92,9 @@ BinanceService::BinanceService(content::BrowserContext* context)
       url_loader_factory_(
           content::BrowserContext::GetDefaultStoragePartition(context_)
               ->GetURLLoaderFactoryForBrowserProcess()),
+      account_balances_cache_(kAccountBalancesTTL, kMaxStale, 1),
+      convert_assets_cache_(kConvertAssetsTTL, kMaxStale, 1),
+      coin_networks_cache_(kCoinNetworksTTL, kMaxStale, 1),
       weak_factory_(this) {
   LoadTokensFromPrefs();
 }
@@ -142,6 +154,15 @@ std::string BinanceService::GetLocaleForURL() {
 }
 
 bool BinanceService::GetAccountBalances(GetAccountBalancesCallback callback) {
+  return account_balances_cache_.Get(
+      oauth_path_account_balances,
+      base::BindOnce(&BinanceService::FetchAccountBalances,
+                     base::Unretained(this)),
+      std::move(callback));
+}
+
+bool BinanceService::FetchAccountBalances(
+    AccountBalancesCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(&BinanceService::OnGetAccountBalances,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(oauth_host_, oauth_path_account_balances);
@@ -150,7 +171,8 @@ bool BinanceService::GetAccountBalances(GetAccountBalancesCallback callback) {
       url, "GET", "", std::move(internal_callback), true, false);
 }
 
-void BinanceService::OnGetAccountBalances(GetAccountBalancesCallback callback,
+void BinanceService::OnGetAccountBalances(
+    AccountBalancesCache::FetchCallback callback,
     const int status, const std::string& body,
     const std::map<std::string, std::string>& headers) {
   BinanceAccountBalances balances;
@@ -251,6 +273,7 @@ bool BinanceService::SetAccessTokens(const std::string& access_token,
                                      const std::string& refresh_token) {
   access_token_ = access_token;
   refresh_token_ = refresh_token;
+  ClearCaches();
 
   std::string encrypted_access_token;
   std::string encrypted_refresh_token;
@@ -280,6 +303,7 @@ bool BinanceService::SetAccessTokens(const std::string& access_token,
 void BinanceService::ResetAccessTokens() {
   access_token_ = "";
   refresh_token_ = "";
+  ClearCaches();
 
   PrefService* prefs = user_prefs::UserPrefs::Get(context_);
   prefs->SetString(kBinanceAccessToken, access_token_);
@@ -361,6 +385,15 @@ void BinanceService::OnGetConvertQuote(
 }
 
 bool BinanceService::GetCoinNetworks(GetCoinNetworksCallback callback) {
+  return coin_networks_cache_.Get(
+      gateway_path_networks,
+      base::BindOnce(&BinanceService::FetchCoinNetworks,
+                     base::Unretained(this)),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool BinanceService::FetchCoinNetworks(
+    CoinNetworksCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(&BinanceService::OnGetCoinNetworks,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(gateway_host_, gateway_path_networks);
@@ -369,14 +402,15 @@ bool BinanceService::GetCoinNetworks(GetCoinNetworksCallback callback) {
 }
 
 void BinanceService::OnGetCoinNetworks(
-  GetCoinNetworksCallback callback,
+  CoinNetworksCache::FetchCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   BinanceCoinNetworks networks;
+  bool success = false;
   if (status >= 200 && status <= 299) {
-    BinanceJSONParser::GetCoinNetworksFromJSON(body, &networks);
+    success = BinanceJSONParser::GetCoinNetworksFromJSON(body, &networks);
   }
-  std::move(callback).Run(networks);
+  std::move(callback).Run(networks, success);
 }
 
 bool BinanceService::GetDepositInfo(const std::string& symbol,
@@ -431,10 +465,23 @@ void BinanceService::OnConfirmConvert(
         body, &error_message, &success_status);
   }
 
+  // The converted amounts are now out of date.
+  if (success_status)
+    account_balances_cache_.Clear();
+
   std::move(callback).Run(success_status, error_message);
 }
 
 bool BinanceService::GetConvertAssets(GetConvertAssetsCallback callback) {
+  return convert_assets_cache_.Get(
+      oauth_path_convert_assets,
+      base::BindOnce(&BinanceService::FetchConvertAssets,
+                     base::Unretained(this)),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool BinanceService::FetchConvertAssets(
+    ConvertAssetsCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(&BinanceService::OnGetConvertAssets,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(oauth_host_, oauth_path_convert_assets);
@@ -443,16 +490,18 @@ bool BinanceService::GetConvertAssets(GetConvertAssetsCallback callback) {
       url, "GET", "", std::move(internal_callback), true, false);
 }
 
-void BinanceService::OnGetConvertAssets(GetConvertAssetsCallback callback,
+void BinanceService::OnGetConvertAssets(
+    ConvertAssetsCache::FetchCallback callback,
     const int status, const std::string& body,
     const std::map<std::string, std::string>& headers) {
   BinanceConvertAsserts assets;
+  bool success = false;
 
   if (status >= 200 && status <= 299) {
-    BinanceJSONParser::GetConvertAssetsFromJSON(body, &assets);
+    success = BinanceJSONParser::GetConvertAssetsFromJSON(body, &assets);
   }
 
-  std::move(callback).Run(assets);
+  std::move(callback).Run(assets, success);
 }
 
 bool BinanceService::RevokeToken(RevokeTokenCallback callback) {
@@ -479,6 +528,12 @@ void BinanceService::OnRevokeToken(RevokeTokenCallback callback,
   std::move(callback).Run(success);
 }
 
+void BinanceService::ClearCaches() {
+  account_balances_cache_.Clear();
+  convert_assets_cache_.Clear();
+  coin_networks_cache_.Clear();
+}
+
 base::SequencedTaskRunner* BinanceService::io_task_runner() {
   if (!io_task_runner_) {
     io_task_runner_ = base::CreateSequencedTaskRunner(
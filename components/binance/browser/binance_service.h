@@ -19,6 +19,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_observer.h"
+#include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_cache.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -111,15 +112,23 @@ class BinanceService : public KeyedService {
   using URLRequestCallback =
       base::OnceCallback<void(const int, const std::string&,
                               const std::map<std::string, std::string>&)>;
+  using AccountBalancesCache =
+      ntp_widget_utils::DataCache<BinanceAccountBalances>;
+  using ConvertAssetsCache = ntp_widget_utils::DataCache<BinanceConvertAsserts>;
+  using CoinNetworksCache = ntp_widget_utils::DataCache<BinanceCoinNetworks>;
 
   base::SequencedTaskRunner* io_task_runner();
+  void ClearCaches();
+  bool FetchAccountBalances(AccountBalancesCache::FetchCallback callback);
+  bool FetchConvertAssets(ConvertAssetsCache::FetchCallback callback);
+  bool FetchCoinNetworks(CoinNetworksCache::FetchCallback callback);
   void OnGetAccessToken(GetAccessTokenCallback callback,
                            const int status, const std::string& body,
                            const std::map<std::string, std::string>& headers);
   void OnGetConvertQuote(GetConvertQuoteCallback callback,
                            const int status, const std::string& body,
                            const std::map<std::string, std::string>& headers);
-  void OnGetAccountBalances(GetAccountBalancesCallback callback,
+  void OnGetAccountBalances(AccountBalancesCache::FetchCallback callback,
                            const int status, const std::string& body,
                            const std::map<std::string, std::string>& headers);
   void OnGetDepositInfo(GetDepositInfoCallback callback,
@@ -128,13 +137,13 @@ class BinanceService : public KeyedService {
   void OnConfirmConvert(ConfirmConvertCallback callback,
                         const int status, const std::string& body,
                         const std::map<std::string, std::string>& headers);
-  void OnGetConvertAssets(GetConvertAssetsCallback callback,
+  void OnGetConvertAssets(ConvertAssetsCache::FetchCallback callback,
                           const int status, const std::string& body,
                           const std::map<std::string, std::string>& headers);
   void OnRevokeToken(RevokeTokenCallback callback,
                      const int status, const std::string& body,
                      const std::map<std::string, std::string>& headers);
-  void OnGetCoinNetworks(GetCoinNetworksCallback callback,
+  void OnGetCoinNetworks(CoinNetworksCache::FetchCallback callback,
         const int status, const std::string& body,
         const std::map<std::string, std::string>& headers);
   bool OAuthRequest(const GURL& url, const std::string& method,
@@ -162,6 +171,11 @@ class BinanceService : public KeyedService {
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+  // Shared by every new tab page showing the widget, and cleared when the
+  // account changes.
+  AccountBalancesCache account_balances_cache_;
+  ConvertAssetsCache convert_assets_cache_;
+  CoinNetworksCache coin_networks_cache_;
   base::WeakPtrFactory<BinanceService> weak_factory_;
 
   FRIEND_TEST_ALL_PREFIXES(BinanceAPIBrowserTest, GetOAuthClientURL);
@@ -3,8 +3,13 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
+#include <atomic>
+
 #include "base/path_service.h"
 #include "base/scoped_observer.h"
+#include "base/strings/stringprintf.h"
+#include "base/test/bind.h"
 #include "brave/browser/binance/binance_service_factory.h"
 #include "brave/common/brave_paths.h"
 #include "brave/common/pref_names.h"
@@ -200,6 +205,36 @@ std::unique_ptr<net::test_server::HttpResponse> HandleRequestServerError(
   return std::move(http_response);
 }
 
+// Answers account balance requests with the access token as the free amount
+// so that callers can tell which account they got, and counts them.
+std::unique_ptr<net::test_server::HttpResponse> HandleCountedBalancesRequest(
+    std::atomic<int>* requests,
+    const net::test_server::HttpRequest& request) {
+  if (request.GetURL().path() != oauth_path_account_balances)
+    return HandleRequest(request);
+
+  (*requests)++;
+  std::string access_token;
+  net::GetValueForKeyInQuery(request.GetURL(), "access_token", &access_token);
+  auto http_response = std::make_unique<net::test_server::BasicHttpResponse>();
+  http_response->set_code(net::HTTP_OK);
+  http_response->set_content_type("text/html");
+  http_response->set_content(base::StringPrintf(R"({
+      "code": "000000",
+      "message": null,
+      "data": [{
+        "asset": "BAT",
+        "free": "%s",
+        "locked": "0.00000000",
+        "freeze": "0.00000000",
+        "withdrawing": "0.00000000",
+        "btcValuation": "0.021100",
+        "fiatValuation": "20000.00000"
+      }]
+    })", access_token.c_str()));
+  return std::move(http_response);
+}
+
 const char kBinanceAPIExistsScript[] =
     "window.domAutomationController.send(!!chrome.binance)";
 
@@ -813,3 +848,47 @@ IN_PROC_BROWSER_TEST_F(BinanceAPIBrowserTest, GetCoinNetworksServerError) {
           base::Unretained(this))));
   WaitForGetCoinNetworks(BinanceCoinNetworks());
 }
+
+IN_PROC_BROWSER_TEST_F(BinanceAPIBrowserTest,
+                       GetAccountBalancesSharesRequestsUntilCleared) {
+  std::atomic<int> requests(0);
+  ResetHTTPSServer(
+      base::BindRepeating(&HandleCountedBalancesRequest, &requests));
+  EXPECT_TRUE(NavigateToNewTabUntilLoadStop());
+  auto* service = GetBinanceService();
+  ASSERT_TRUE(service->SetAccessTokens("old", "refresh"));
+
+  std::vector<std::string> free_amounts;
+  std::unique_ptr<base::RunLoop> run_loop;
+  size_t expected_results = 0;
+  auto callback = base::BindLambdaForTesting(
+      [&](const BinanceAccountBalances& balances, bool success) {
+        EXPECT_TRUE(success);
+        auto it = balances.find("BAT");
+        ASSERT_NE(it, balances.end());
+        free_amounts.push_back(it->second[0]);
+        if (free_amounts.size() == expected_results)
+          run_loop->Quit();
+      });
+
+  // Concurrent callers share one request, but a caller that comes after the
+  // account changed gets a request of its own instead of the old balances.
+  run_loop = std::make_unique<base::RunLoop>();
+  expected_results = 3;
+  ASSERT_TRUE(service->GetAccountBalances(callback));
+  ASSERT_TRUE(service->GetAccountBalances(callback));
+  ASSERT_TRUE(service->SetAccessTokens("new", "refresh"));
+  ASSERT_TRUE(service->GetAccountBalances(callback));
+  run_loop->Run();
+  EXPECT_EQ(2, requests.load());
+  EXPECT_EQ(2, std::count(free_amounts.begin(), free_amounts.end(), "old"));
+  EXPECT_EQ(1, std::count(free_amounts.begin(), free_amounts.end(), "new"));
+
+  // Only the balances of the new account were cached.
+  run_loop = std::make_unique<base::RunLoop>();
+  expected_results = 4;
+  ASSERT_TRUE(service->GetAccountBalances(callback));
+  run_loop->Run();
+  EXPECT_EQ(2, requests.load());
+  EXPECT_EQ("new", free_amounts.back());
+}
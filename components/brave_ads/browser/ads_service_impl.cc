@@ -203,7 +203,6 @@ AdsServiceImpl::AdsServiceImpl(Profile* profile)
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       base_path_(profile_->GetPath().AppendASCII("ads_service")),
       last_idle_state_(ui::IdleState::IDLE_STATE_ACTIVE),
-      last_idle_time_(0),
       display_service_(NotificationDisplayService::GetForProfile(profile_)),
       rewards_service_(
           brave_rewards::RewardsServiceFactory::GetForProfile(profile_)),
@@ -523,7 +522,9 @@ void AdsServiceImpl::Shutdown() {
   }
   url_loaders_.clear();
 
-  idle_poll_timer_.Stop();
+#if !defined(OS_ANDROID)
+  IdleStateMonitor::GetInstance()->RemoveObserver(this);
+#endif
 
   bat_ads_.reset();
   bat_ads_client_receiver_.reset();
@@ -643,7 +644,7 @@ void AdsServiceImpl::OnInitialize(const int32_t result) {
 
   MaybeViewAdNotification();
 
-  StartCheckIdleStateTimer();
+  StartObservingIdleState();
 }
 
 void AdsServiceImpl::ShutdownBatAds() {
@@ -878,51 +879,15 @@ bool AdsServiceImpl::IsDebug() const {
 #endif
 }
 
-void AdsServiceImpl::StartCheckIdleStateTimer() {
+void AdsServiceImpl::StartObservingIdleState() {
 #if !defined(OS_ANDROID)
-  idle_poll_timer_.Stop();
+  // The monitor restarts observers from the active state
+  last_idle_state_ = ui::IdleState::IDLE_STATE_ACTIVE;
 
-  idle_poll_timer_.Start(FROM_HERE, base::TimeDelta::FromSeconds(1), this,
-                         &AdsServiceImpl::CheckIdleState);
+  IdleStateMonitor::GetInstance()->AddObserver(this, GetIdleTimeThreshold());
 #endif
 }
 
-void AdsServiceImpl::CheckIdleState() {
-  const int idle_threshold = GetIdleTimeThreshold();
-  const ui::IdleState idle_state = ui::CalculateIdleState(idle_threshold);
-  ProcessIdleState(idle_state, last_idle_time_);
-
-  last_idle_time_ = ui::CalculateIdleTime();
-}
-
-void AdsServiceImpl::ProcessIdleState(const ui::IdleState idle_state,
-                                      const int idle_time) {
-  if (!connected() || idle_state == last_idle_state_) {
-    return;
-  }
-
-  switch (idle_state) {
-    case ui::IdleState::IDLE_STATE_ACTIVE: {
-      const bool was_locked =
-          last_idle_state_ == ui::IdleState::IDLE_STATE_LOCKED;
-      bat_ads_->OnUnIdle(idle_time, was_locked);
-      break;
-    }
-
-    case ui::IdleState::IDLE_STATE_IDLE:
-    case ui::IdleState::IDLE_STATE_LOCKED: {
-      bat_ads_->OnIdle();
-      break;
-    }
-
-    case ui::IdleState::IDLE_STATE_UNKNOWN: {
-      break;
-    }
-  }
-
-  last_idle_state_ = idle_state;
-}
-
 int AdsServiceImpl::GetIdleTimeThreshold() {
   return GetIntegerPref(ads::prefs::kIdleTimeThreshold);
 }
@@ -1660,7 +1625,9 @@ void AdsServiceImpl::OnPrefsChanged(const std::string& pref) {
     // Record P3A.
     brave_rewards::UpdateAdsP3AOnPreferenceChange(profile_->GetPrefs(), pref);
   } else if (pref == ads::prefs::kIdleTimeThreshold) {
-    StartCheckIdleStateTimer();
+    if (connected()) {
+      StartObservingIdleState();
+    }
   } else if (pref == brave_rewards::prefs::kWalletBrave) {
     OnWalletUpdated();
   }
@@ -2069,4 +2036,32 @@ void AdsServiceImpl::OnForeground() {
   bat_ads_->OnForeground();
 }
 
+void AdsServiceImpl::OnIdleStateChanged(const ui::IdleState idle_state,
+                                        const int idle_time) {
+  if (!connected() || idle_state == last_idle_state_) {
+    return;
+  }
+
+  switch (idle_state) {
+    case ui::IdleState::IDLE_STATE_ACTIVE: {
+      const bool was_locked =
+          last_idle_state_ == ui::IdleState::IDLE_STATE_LOCKED;
+      bat_ads_->OnUnIdle(idle_time, was_locked);
+      break;
+    }
+
+    case ui::IdleState::IDLE_STATE_IDLE:
+    case ui::IdleState::IDLE_STATE_LOCKED: {
+      bat_ads_->OnIdle();
+      break;
+    }
+
+    case ui::IdleState::IDLE_STATE_UNKNOWN: {
+      break;
+    }
+  }
+
+  last_idle_state_ = idle_state;
+}
+
 }  // namespace brave_ads
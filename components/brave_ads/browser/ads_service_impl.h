@@ -25,6 +25,7 @@
 #include "bat/ledger/mojom_structs.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/background_helper.h"
+#include "brave/components/brave_ads/browser/idle_state_monitor.h"
 #include "brave/components/brave_ads/browser/notification_helper.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service_observer.h"
 #include "brave/components/brave_user_model/browser/user_model_file_service.h"
@@ -64,6 +65,7 @@ class AdsServiceImpl : public AdsService,
                        public ads::AdsClient,
                        public history::HistoryServiceObserver,
                        BackgroundHelper::Observer,
+                       IdleStateMonitor::Observer,
                        public brave_user_model::Observer,
                        public base::SupportsWeakPtr<AdsServiceImpl> {
  public:
@@ -199,9 +201,7 @@ class AdsServiceImpl : public AdsService,
   void UpdateIsDebugFlag();
   bool IsDebug() const;
 
-  void StartCheckIdleStateTimer();
-  void CheckIdleState();
-  void ProcessIdleState(const ui::IdleState idle_state, const int idle_time);
+  void StartObservingIdleState();
   int GetIdleTimeThreshold();
 
   void OnShow(Profile* profile, const std::string& uuid);
@@ -384,6 +384,10 @@ class AdsServiceImpl : public AdsService,
   void OnBackground() override;
   void OnForeground() override;
 
+  // IdleStateMonitor::Observer implementation
+  void OnIdleStateChanged(const ui::IdleState idle_state,
+                          const int idle_time) override;
+
   ///////////////////////////////////////////////////////////////////////////////
 
   Profile* profile_;  // NOT OWNED
@@ -406,9 +410,6 @@ class AdsServiceImpl : public AdsService,
   std::unique_ptr<ads::Database> database_;
 
   ui::IdleState last_idle_state_;
-  int last_idle_time_;
-
-  base::RepeatingTimer idle_poll_timer_;
 
   PrefChangeRegistrar profile_pref_change_registrar_;
 
@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/strings/stringprintf.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -28,6 +29,73 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Text beyond this many characters does not change how a page is classified,
+// so there is no point in walking or copying it.
+constexpr size_t kMaximumPageTextLength = 32 * 1024;
+
+// Collects the visible text of the page until |limit| characters have been
+// gathered. Unlike document.body.innerText this does not force a layout and
+// stops early, and it skips scripts, hidden subtrees and navigation
+// boilerplate. Elements hidden with CSS are skipped like innerText does, which
+// only needs the computed style, not layout: display:none hides a subtree,
+// while visibility can be overridden by descendants, so it is checked for
+// the parent of each text node.
+constexpr char kExtractPageTextScript[] = R"(
+(function(limit) {
+  const body = document.body;
+  if (!body) {
+    return '';
+  }
+
+  const skipped = new Set([
+    'script', 'style', 'noscript', 'template', 'iframe', 'object', 'svg',
+    'canvas', 'nav', 'footer', 'aside'
+  ]);
+
+  const walker = document.createTreeWalker(body,
+      NodeFilter.SHOW_ELEMENT | NodeFilter.SHOW_TEXT, {
+    acceptNode(node) {
+      if (node.nodeType === Node.TEXT_NODE) {
+        const parent = node.parentElement;
+        return !parent || getComputedStyle(parent).visibility === 'visible' ?
+            NodeFilter.FILTER_ACCEPT : NodeFilter.FILTER_REJECT;
+      }
+      if (skipped.has(node.localName) || node.hidden ||
+          node.getAttribute('aria-hidden') === 'true' ||
+          getComputedStyle(node).display === 'none') {
+        return NodeFilter.FILTER_REJECT;
+      }
+      return NodeFilter.FILTER_SKIP;
+    }
+  });
+
+  const parts = [];
+  let length = 0;
+  while (length < limit && walker.nextNode()) {
+    const text = walker.currentNode.nodeValue.trim();
+    if (text) {
+      parts.push(text);
+      length += text.length + 1;
+    }
+  }
+
+  return parts.join(' ').substring(0, limit);
+})(%zu))";
+
+}  // namespace
+
+// static
+std::string AdsTabHelper::GetExtractPageTextScriptForTesting() {
+  return base::StringPrintf(kExtractPageTextScript, kMaximumPageTextLength);
+}
+
+// static
+size_t AdsTabHelper::GetMaximumPageTextLengthForTesting() {
+  return kMaximumPageTextLength;
+}
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(sessions::SessionTabHelper::IdForTab(web_contents)),
@@ -79,7 +147,8 @@ void AdsTabHelper::RunIsolatedJavaScript(
   DCHECK(render_frame_host);
 
   dom_distiller::RunIsolatedJavaScript(
-      render_frame_host, "document.body.innerText",
+      render_frame_host,
+      base::StringPrintf(kExtractPageTextScript, kMaximumPageTextLength),
       base::BindOnce(&AdsTabHelper::OnJavaScriptResult,
                      weak_factory_.GetWeakPtr()));
 }
@@ -52,6 +52,11 @@ class AdsTabHelper : public content::WebContentsObserver,
   AdsTabHelper(const AdsTabHelper&) = delete;
   AdsTabHelper& operator=(const AdsTabHelper&) = delete;
 
+  // The script run in the page to extract its text for classification, and
+  // the most characters it extracts.
+  static std::string GetExtractPageTextScriptForTesting();
+  static size_t GetMaximumPageTextLengthForTesting();
+
  private:
   friend class content::WebContentsUserData<AdsTabHelper>;
 
@@ -0,0 +1,80 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "base/path_service.h"
+#include "brave/common/brave_paths.h"
+#include "brave/components/brave_ads/browser/ads_tab_helper.h"
+#include "chrome/browser/ui/browser.h"
+#include "chrome/browser/ui/tabs/tab_strip_model.h"
+#include "chrome/test/base/in_process_browser_test.h"
+#include "chrome/test/base/ui_test_utils.h"
+#include "content/public/browser/web_contents.h"
+#include "content/public/test/browser_test.h"
+#include "content/public/test/browser_test_utils.h"
+
+// npm run test -- brave_browser_tests --filter=AdsTabHelperTest.*
+
+namespace brave_ads {
+
+namespace {
+
+constexpr char kVisibleText[] =
+    "Headline First paragraph. Visible child Last paragraph.";
+
+}  // namespace
+
+class AdsTabHelperTest : public InProcessBrowserTest {
+ public:
+  AdsTabHelperTest() = default;
+
+  void SetUpOnMainThread() override {
+    InProcessBrowserTest::SetUpOnMainThread();
+
+    brave::RegisterPathProvider();
+    base::FilePath test_data_dir;
+    base::PathService::Get(brave::DIR_TEST_DATA, &test_data_dir);
+    embedded_test_server()->ServeFilesFromDirectory(test_data_dir);
+    ASSERT_TRUE(embedded_test_server()->Start());
+  }
+
+  content::WebContents* web_contents() {
+    return browser()->tab_strip_model()->GetActiveWebContents();
+  }
+
+  std::string ExtractPageText() {
+    return content::EvalJs(web_contents(),
+                           AdsTabHelper::GetExtractPageTextScriptForTesting())
+        .ExtractString();
+  }
+};
+
+IN_PROC_BROWSER_TEST_F(AdsTabHelperTest, ExtractsVisibleText) {
+  ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("/ads_page_text.html"));
+
+  EXPECT_EQ(kVisibleText, ExtractPageText());
+}
+
+IN_PROC_BROWSER_TEST_F(AdsTabHelperTest, TruncatesLongText) {
+  ui_test_utils::NavigateToURL(
+      browser(), embedded_test_server()->GetURL("/ads_page_text.html"));
+  const size_t limit = AdsTabHelper::GetMaximumPageTextLengthForTesting();
+  ASSERT_TRUE(content::ExecJs(
+      web_contents(),
+      content::JsReplace("document.getElementById('long').textContent = "
+                         "'a'.repeat($1);",
+                         static_cast<int>(limit * 2))));
+
+  const std::string text = ExtractPageText();
+  const std::string prefix = std::string(kVisibleText) + " ";
+  EXPECT_EQ(limit, text.size());
+  EXPECT_EQ(prefix, text.substr(0, prefix.size()));
+  EXPECT_EQ(std::string(limit - prefix.size(), 'a'),
+            text.substr(prefix.size()));
+}
+
+}  // namespace brave_ads
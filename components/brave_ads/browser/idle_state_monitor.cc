@@ -0,0 +1,143 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/browser/idle_state_monitor.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "base/bind.h"
+
+namespace brave_ads {
+
+namespace {
+
+constexpr base::TimeDelta kMinimumCheckIdleStateDelay =
+    base::TimeDelta::FromSeconds(1);
+
+// Bounds how long returning from idle goes unnoticed
+constexpr base::TimeDelta kMaximumIdleCheckIdleStateDelay =
+    base::TimeDelta::FromSeconds(4);
+
+// Bounds how long locking the screen goes unnoticed
+constexpr base::TimeDelta kMaximumActiveCheckIdleStateDelay =
+    base::TimeDelta::FromSeconds(30);
+
+}  // namespace
+
+IdleStateMonitor::IdleStateMonitor()
+    : idle_check_delay_(kMinimumCheckIdleStateDelay) {}
+
+IdleStateMonitor::~IdleStateMonitor() = default;
+
+// static
+IdleStateMonitor* IdleStateMonitor::GetInstance() {
+  return base::Singleton<IdleStateMonitor>::get();
+}
+
+void IdleStateMonitor::AddObserver(Observer* observer,
+                                   const int idle_threshold) {
+  DCHECK(observer);
+
+  ObserverState& state = observers_[observer];
+  state.idle_threshold = idle_threshold;
+  state.idle_state = ui::IdleState::IDLE_STATE_ACTIVE;
+
+  ScheduleCheckIdleState(kMinimumCheckIdleStateDelay);
+}
+
+void IdleStateMonitor::RemoveObserver(Observer* observer) {
+  observers_.erase(observer);
+
+  if (observers_.empty()) {
+    timer_.Stop();
+  }
+}
+
+int IdleStateMonitor::CalculateIdleTime() {
+  return ui::CalculateIdleTime();
+}
+
+bool IdleStateMonitor::CheckIdleStateIsLocked() {
+  return ui::CheckIdleStateIsLocked();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void IdleStateMonitor::CheckIdleState() {
+  const int idle_time = CalculateIdleTime();
+  const bool is_locked = CheckIdleStateIsLocked();
+
+  // Observers may add or remove observers when notified
+  std::vector<Observer*> observers;
+  for (const auto& observer : observers_) {
+    observers.push_back(observer.first);
+  }
+
+  for (Observer* observer : observers) {
+    const auto iter = observers_.find(observer);
+    if (iter == observers_.end()) {
+      continue;
+    }
+
+    ObserverState& state = iter->second;
+
+    ui::IdleState idle_state = ui::IdleState::IDLE_STATE_ACTIVE;
+    if (is_locked) {
+      idle_state = ui::IdleState::IDLE_STATE_LOCKED;
+    } else if (idle_time >= state.idle_threshold) {
+      idle_state = ui::IdleState::IDLE_STATE_IDLE;
+    }
+
+    if (idle_state == state.idle_state) {
+      continue;
+    }
+
+    state.idle_state = idle_state;
+    observer->OnIdleStateChanged(idle_state, last_idle_time_);
+  }
+
+  last_idle_time_ = idle_time;
+
+  if (!observers_.empty()) {
+    ScheduleCheckIdleState(GetNextCheckIdleStateDelay());
+  }
+}
+
+void IdleStateMonitor::ScheduleCheckIdleState(const base::TimeDelta delay) {
+  timer_.Start(FROM_HERE, delay,
+               base::BindOnce(&IdleStateMonitor::CheckIdleState,
+                              base::Unretained(this)));
+}
+
+base::TimeDelta IdleStateMonitor::GetNextCheckIdleStateDelay() {
+  base::TimeDelta delay = kMaximumActiveCheckIdleStateDelay;
+  bool is_any_observer_idle = false;
+
+  for (const auto& observer : observers_) {
+    const ObserverState& state = observer.second;
+    if (state.idle_state != ui::IdleState::IDLE_STATE_ACTIVE) {
+      is_any_observer_idle = true;
+      continue;
+    }
+
+    // Idle time cannot grow faster than the wall clock, so this observer
+    // cannot become idle any sooner
+    delay = std::min(delay, base::TimeDelta::FromSeconds(state.idle_threshold -
+                                                         last_idle_time_));
+  }
+
+  if (is_any_observer_idle) {
+    delay = std::min(delay, idle_check_delay_);
+    idle_check_delay_ =
+        std::min(idle_check_delay_ * 2, kMaximumIdleCheckIdleStateDelay);
+  } else {
+    idle_check_delay_ = kMinimumCheckIdleStateDelay;
+  }
+
+  return std::max(delay, kMinimumCheckIdleStateDelay);
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,76 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_IDLE_STATE_MONITOR_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_IDLE_STATE_MONITOR_H_
+
+#include "base/containers/flat_map.h"
+#include "base/memory/singleton.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "ui/base/idle/idle.h"
+
+namespace brave_ads {
+
+// Notifies observers when the user crosses their idle threshold or locks the
+// screen. The idle time is sampled once for all observers, and only as often
+// as needed: while every observer is active, the next sample is taken when
+// the nearest threshold could first be crossed. Returning from idle raises no
+// platform event, so while any observer is idle sampling backs off from one
+// second to a few seconds.
+class IdleStateMonitor {
+ public:
+  class Observer {
+   public:
+    // |idle_time| is the last sampled idle time, in seconds, before the state
+    // changed.
+    virtual void OnIdleStateChanged(const ui::IdleState idle_state,
+                                    const int idle_time) = 0;
+
+   protected:
+    virtual ~Observer() = default;
+  };
+
+  IdleStateMonitor(const IdleStateMonitor&) = delete;
+  IdleStateMonitor& operator=(const IdleStateMonitor&) = delete;
+
+  static IdleStateMonitor* GetInstance();
+
+  // |idle_threshold| is in seconds. Adding an existing observer updates its
+  // threshold and restarts it from the active state.
+  void AddObserver(Observer* observer, const int idle_threshold);
+  void RemoveObserver(Observer* observer);
+
+ protected:
+  friend struct base::DefaultSingletonTraits<IdleStateMonitor>;
+
+  IdleStateMonitor();
+  virtual ~IdleStateMonitor();
+
+  // Overridden in tests.
+  virtual int CalculateIdleTime();
+  virtual bool CheckIdleStateIsLocked();
+
+ private:
+  struct ObserverState {
+    int idle_threshold = 0;
+    ui::IdleState idle_state = ui::IdleState::IDLE_STATE_ACTIVE;
+  };
+
+  void CheckIdleState();
+  void ScheduleCheckIdleState(const base::TimeDelta delay);
+  base::TimeDelta GetNextCheckIdleStateDelay();
+
+  base::flat_map<Observer*, ObserverState> observers_;
+
+  int last_idle_time_ = 0;
+  base::TimeDelta idle_check_delay_;
+
+  base::OneShotTimer timer_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_IDLE_STATE_MONITOR_H_
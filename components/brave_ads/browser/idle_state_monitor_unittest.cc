@@ -0,0 +1,135 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/browser/idle_state_monitor.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=IdleStateMonitorTest.*
+
+namespace brave_ads {
+
+namespace {
+
+class TestIdleStateMonitor : public IdleStateMonitor {
+ public:
+  explicit TestIdleStateMonitor(
+      base::test::TaskEnvironment* task_environment)
+      : task_environment_(task_environment),
+        last_input_time_(task_environment->NowTicks()) {}
+  ~TestIdleStateMonitor() override = default;
+
+  void SimulateInput() { last_input_time_ = task_environment_->NowTicks(); }
+  void set_locked(bool locked) { locked_ = locked; }
+  int check_count() const { return check_count_; }
+
+ protected:
+  int CalculateIdleTime() override {
+    check_count_++;
+    return (task_environment_->NowTicks() - last_input_time_).InSeconds();
+  }
+
+  bool CheckIdleStateIsLocked() override { return locked_; }
+
+ private:
+  base::test::TaskEnvironment* task_environment_;
+  base::TimeTicks last_input_time_;
+  bool locked_ = false;
+  int check_count_ = 0;
+};
+
+class TestObserver : public IdleStateMonitor::Observer {
+ public:
+  void OnIdleStateChanged(const ui::IdleState idle_state,
+                          const int idle_time) override {
+    changes_.push_back(std::make_pair(idle_state, idle_time));
+  }
+
+  const std::vector<std::pair<ui::IdleState, int>>& changes() const {
+    return changes_;
+  }
+
+ private:
+  std::vector<std::pair<ui::IdleState, int>> changes_;
+};
+
+}  // namespace
+
+class IdleStateMonitorTest : public ::testing::Test {
+ protected:
+  IdleStateMonitorTest() : monitor_(&task_environment_) {}
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  TestIdleStateMonitor monitor_;
+  TestObserver observer_;
+};
+
+TEST_F(IdleStateMonitorTest, NotifiesWhenThresholdIsCrossed) {
+  monitor_.AddObserver(&observer_, 15);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(14));
+  EXPECT_TRUE(observer_.changes().empty());
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(2));
+  ASSERT_EQ(1u, observer_.changes().size());
+  EXPECT_EQ(ui::IdleState::IDLE_STATE_IDLE, observer_.changes()[0].first);
+
+  monitor_.RemoveObserver(&observer_);
+}
+
+TEST_F(IdleStateMonitorTest, NotifiesWhenActiveAgain) {
+  monitor_.AddObserver(&observer_, 15);
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(60));
+  ASSERT_EQ(1u, observer_.changes().size());
+
+  monitor_.SimulateInput();
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(4));
+  ASSERT_EQ(2u, observer_.changes().size());
+  EXPECT_EQ(ui::IdleState::IDLE_STATE_ACTIVE, observer_.changes()[1].first);
+  EXPECT_GE(observer_.changes()[1].second, 56);
+
+  monitor_.RemoveObserver(&observer_);
+}
+
+TEST_F(IdleStateMonitorTest, NotifiesWhenLocked) {
+  monitor_.AddObserver(&observer_, 15);
+  monitor_.SimulateInput();
+  monitor_.set_locked(true);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  ASSERT_EQ(1u, observer_.changes().size());
+  EXPECT_EQ(ui::IdleState::IDLE_STATE_LOCKED, observer_.changes()[0].first);
+
+  monitor_.RemoveObserver(&observer_);
+}
+
+TEST_F(IdleStateMonitorTest, ChecksRarelyWhileActive) {
+  monitor_.AddObserver(&observer_, 15);
+
+  for (int i = 0; i < 60; i++) {
+    monitor_.SimulateInput();
+    task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  }
+
+  EXPECT_TRUE(observer_.changes().empty());
+  EXPECT_LE(monitor_.check_count(), 5);
+
+  monitor_.RemoveObserver(&observer_);
+}
+
+TEST_F(IdleStateMonitorTest, StopsCheckingWithoutObservers) {
+  monitor_.AddObserver(&observer_, 15);
+  monitor_.RemoveObserver(&observer_);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(60));
+  EXPECT_EQ(0, monitor_.check_count());
+}
+
+}  // namespace brave_ads
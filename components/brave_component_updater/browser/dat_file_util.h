@@ -12,6 +12,8 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/logging.h"
 
 namespace brave_component_updater {
 
@@ -41,6 +43,29 @@ LoadDATFileDataResult<T> LoadDATFileData(
       std::move(client), std::move(buffer));
 }
 
+// Deserializes a T straight from a read-only mapping of the DAT file, so the
+// serialized form is never copied onto the heap. Only use this for types
+// that do not keep pointers into the data they were deserialized from, as
+// the mapping is gone once this returns. Returns nullptr on failure.
+template<typename T>
+std::unique_ptr<T> LoadDATFileDataFromMappedFile(
+    const base::FilePath& dat_file_path) {
+  base::MemoryMappedFile dat_file;
+  if (!dat_file.Initialize(dat_file_path) || dat_file.length() == 0) {
+    LOG(ERROR) << "LoadDATFileDataFromMappedFile: cannot map dat file "
+               << dat_file_path;
+    return nullptr;
+  }
+
+  auto client = std::make_unique<T>();
+  if (!client->deserialize(reinterpret_cast<const char*>(dat_file.data()),
+                           dat_file.length())) {
+    LOG(ERROR) << "LoadDATFileDataFromMappedFile: cannot deserialize dat file "
+               << dat_file_path;
+    return nullptr;
+  }
+  return client;
+}
 
 }  // namespace brave_component_updater
 
@@ -16,7 +16,7 @@
 namespace brave_perf_predictor {
 
 BandwidthSavingsPredictor::BandwidthSavingsPredictor(
-    const NamedThirdPartyRegistry* registry)
+    NamedThirdPartyRegistry* registry)
     : tp_registry_(registry) {}
 
 BandwidthSavingsPredictor::~BandwidthSavingsPredictor() = default;
@@ -50,6 +50,7 @@ void BandwidthSavingsPredictor::OnSubresourceBlocked(
   feature_map_["adblockRequests"] += 1;
 
   if (tp_registry_) {
+    tp_registry_->InitializeDefault();
     const auto tp_name = tp_registry_->GetThirdParty(resource_url);
     if (tp_name.has_value())
       feature_map_["thirdParties." + tp_name.value() + ".blocked"] = 1;
@@ -40,7 +40,7 @@ namespace brave_perf_predictor {
 // of any resources fully loaded or blocked.
 class BandwidthSavingsPredictor {
  public:
-  explicit BandwidthSavingsPredictor(const NamedThirdPartyRegistry* registry);
+  explicit BandwidthSavingsPredictor(NamedThirdPartyRegistry* registry);
   ~BandwidthSavingsPredictor();
 
   BandwidthSavingsPredictor(const BandwidthSavingsPredictor&) = delete;
@@ -63,7 +63,7 @@ class BandwidthSavingsPredictor {
                            FeaturiseResourceLoading);
 
   GURL main_frame_url_;
-  const NamedThirdPartyRegistry* tp_registry_;  // not owned
+  NamedThirdPartyRegistry* tp_registry_;  // not owned
   base::flat_map<std::string, double> feature_map_;
 };
 
@@ -5,10 +5,11 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry.h"
 
-#include <tuple>
+#include <limits>
+#include <unordered_map>
+#include <utility>
 
 #include "base/bind.h"
-#include "base/containers/flat_set.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
@@ -27,11 +28,23 @@ namespace brave_perf_predictor {
 
 namespace {
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
-  base::flat_map<std::string, std::string> entity_by_domain;
-  base::flat_map<std::string, std::string> entity_by_root_domain;
+// Marks a root domain claimed by more than one entity.
+constexpr size_t kClashingEntity = std::numeric_limits<size_t>::max();
+
+}  // namespace
+
+NamedThirdPartyRegistry::EntityMappings::EntityMappings() = default;
+NamedThirdPartyRegistry::EntityMappings::EntityMappings(EntityMappings&&) =
+    default;
+NamedThirdPartyRegistry::EntityMappings&
+NamedThirdPartyRegistry::EntityMappings::operator=(EntityMappings&&) = default;
+NamedThirdPartyRegistry::EntityMappings::~EntityMappings() = default;
+
+// static
+NamedThirdPartyRegistry::EntityMappings NamedThirdPartyRegistry::ParseMappings(
+    const base::StringPiece entities,
+    bool discard_irrelevant) {
+  EntityMappings mappings;
 
   // Parse the JSON
   base::Optional<base::Value> document = base::JSONReader::Read(entities);
@@ -40,7 +53,10 @@ ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
     return {};
   }
 
-  // Collect the mappings
+  // Collect the mappings into unsorted vectors first, so the flat maps are
+  // sorted once rather than on every insertion.
+  std::vector<std::pair<std::string, EntityIndex>> entity_by_domain;
+  std::unordered_map<std::string, size_t> entity_by_root_domain;
   for (auto& entity : document->GetList()) {
     const std::string* entity_name = entity.FindStringPath("name");
     if (!entity_name)
@@ -52,41 +68,57 @@ ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
     const auto* entity_domains = entity.FindListPath("domains");
     if (!entity_domains)
       continue;
+    if (mappings.entity_names.size() >
+        std::numeric_limits<EntityIndex>::max()) {
+      LOG(ERROR) << "Too many third-party entities";
+      return {};
+    }
+
+    const EntityIndex entity_index = mappings.entity_names.size();
+    mappings.entity_names.push_back(*entity_name);
 
     for (auto& entity_domain_it : entity_domains->GetList()) {
       if (!entity_domain_it.is_string()) {
         continue;
       }
-      const base::StringPiece entity_domain(entity_domain_it.GetString());
+      const std::string& entity_domain = entity_domain_it.GetString();
+      entity_by_domain.emplace_back(entity_domain, entity_index);
 
-      const auto inserted =
-          entity_by_domain.emplace(entity_domain, *entity_name);
-      if (!inserted.second) {
-        VLOG(2) << "Malformed data: duplicate domain " << entity_domain;
-      }
       auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
           entity_domain,
           net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
-
-      auto root_entity_entry = entity_by_root_domain.find(root_domain);
-      if (root_entity_entry != entity_by_root_domain.end() &&
-          root_entity_entry->second != *entity_name) {
+      const auto inserted =
+          entity_by_root_domain.emplace(std::move(root_domain), entity_index);
+      if (!inserted.second && inserted.first->second != entity_index) {
         // If there is a clash at root domain level, neither is correct
-        entity_by_root_domain.erase(root_entity_entry);
-      } else {
-        entity_by_root_domain.emplace(root_domain, *entity_name);
+        inserted.first->second = kClashingEntity;
       }
     }
   }
 
-  entity_by_domain.shrink_to_fit();
-  entity_by_root_domain.shrink_to_fit();
-  return std::make_tuple(entity_by_domain, entity_by_root_domain);
+  // Duplicate domains keep the entity listed first.
+  const size_t domain_count = entity_by_domain.size();
+  mappings.entity_by_domain =
+      base::flat_map<std::string, EntityIndex>(std::move(entity_by_domain));
+  if (mappings.entity_by_domain.size() != domain_count)
+    VLOG(2) << "Malformed data: duplicate domains";
+
+  std::vector<std::pair<std::string, EntityIndex>> root_domains;
+  root_domains.reserve(entity_by_root_domain.size());
+  for (auto& root_domain : entity_by_root_domain) {
+    if (root_domain.second != kClashingEntity)
+      root_domains.emplace_back(root_domain.first, root_domain.second);
+  }
+  mappings.entity_by_root_domain =
+      base::flat_map<std::string, EntityIndex>(std::move(root_domains));
+
+  mappings.entity_names.shrink_to_fit();
+  return mappings;
 }
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseFromResource(int resource_id) {
+// static
+NamedThirdPartyRegistry::EntityMappings
+NamedThirdPartyRegistry::ParseFromResource(int resource_id) {
   // TODO(AndriusA): insert trace event here
   SCOPED_UMA_HISTOGRAM_TIMER(
       "Brave.Savings.NamedThirdPartyRegistry.LoadTimeMS");
@@ -97,30 +129,26 @@ ParseFromResource(int resource_id) {
   return ParseMappings(data_resource, true);
 }
 
-}  // namespace
-
 bool NamedThirdPartyRegistry::LoadMappings(const base::StringPiece entities,
                                            bool discard_irrelevant) {
-  // Reset previous mappings
-  entity_by_domain_.clear();
-  entity_by_root_domain_.clear();
+  // Replaces any previous mappings, and keeps InitializeDefault() from
+  // replacing these later
+  default_load_requested_ = true;
   initialized_ = false;
-
-  tie(entity_by_domain_, entity_by_root_domain_) =
-      ParseMappings(entities, discard_irrelevant);
-  if (entity_by_domain_.size() == 0 || entity_by_root_domain_.size() == 0)
+  mappings_ = ParseMappings(entities, discard_irrelevant);
+  if (mappings_.entity_by_domain.empty() ||
+      mappings_.entity_by_root_domain.empty())
     return false;
 
   initialized_ = true;
   return true;
 }
 
-void NamedThirdPartyRegistry::UpdateMappings(
-    std::tuple<base::flat_map<std::string, std::string>,
-               base::flat_map<std::string, std::string>> entity_mappings) {
-  tie(entity_by_domain_, entity_by_root_domain_) = entity_mappings;
-  VLOG(2) << "Loaded " << entity_by_domain_.size() << " mappings by domain and "
-          << entity_by_root_domain_.size() << " by root domain; size";
+void NamedThirdPartyRegistry::UpdateMappings(EntityMappings entity_mappings) {
+  mappings_ = std::move(entity_mappings);
+  VLOG(2) << "Loaded " << mappings_.entity_names.size() << " entities with "
+          << mappings_.entity_by_domain.size() << " mappings by domain and "
+          << mappings_.entity_by_root_domain.size() << " by root domain";
   initialized_ = true;
 }
 
@@ -136,16 +164,16 @@ base::Optional<std::string> NamedThirdPartyRegistry::GetThirdParty(
     return base::nullopt;
 
   if (url.has_host()) {
-    auto domain_entry = entity_by_domain_.find(url.host());
-    if (domain_entry != entity_by_domain_.end())
-      return domain_entry->second;
+    auto domain_entry = mappings_.entity_by_domain.find(url.host());
+    if (domain_entry != mappings_.entity_by_domain.end())
+      return mappings_.entity_names[domain_entry->second];
 
     auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
         url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
-    auto root_domain_entry = entity_by_root_domain_.find(root_domain);
-    if (root_domain_entry != entity_by_root_domain_.end())
-      return root_domain_entry->second;
+    auto root_domain_entry = mappings_.entity_by_root_domain.find(root_domain);
+    if (root_domain_entry != mappings_.entity_by_root_domain.end())
+      return mappings_.entity_names[root_domain_entry->second];
   }
 
   return base::nullopt;
@@ -156,6 +184,10 @@ NamedThirdPartyRegistry::NamedThirdPartyRegistry() = default;
 NamedThirdPartyRegistry::~NamedThirdPartyRegistry() = default;
 
 void NamedThirdPartyRegistry::InitializeDefault() {
+  if (default_load_requested_)
+    return;
+  default_load_requested_ = true;
+
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::ThreadPool(), base::MayBlock()},
       base::BindOnce(&ParseFromResource, IDR_THIRD_PARTY_ENTITIES),
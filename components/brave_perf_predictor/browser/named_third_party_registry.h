@@ -6,8 +6,10 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 
+#include <stdint.h>
+
 #include <string>
-#include <tuple>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
@@ -19,6 +21,10 @@ namespace brave_perf_predictor {
 // Retrieves publicly known Third Party (organisation) for a given URL, using
 // data from the Third Party Web repository
 // (https://github.com/patrickhulce/third-party-web).
+//
+// Entity names are interned once and the domain tables only hold an index into
+// them. The bundled resource is not parsed until the first blocked resource
+// asks for it.
 class NamedThirdPartyRegistry : public KeyedService {
  public:
   NamedThirdPartyRegistry();
@@ -31,21 +37,36 @@ class NamedThirdPartyRegistry : public KeyedService {
   // entities not relevant to the bandwith prediction model (i.e. those not
   // seen in training the model).
   bool LoadMappings(const base::StringPiece entities, bool discard_irrelevant);
-  // Default initialization - asynchronously load from bundled resource
+  // Default initialization - asynchronously load from bundled resource. Only
+  // the first call does any work.
   void InitializeDefault();
   base::Optional<std::string> GetThirdParty(
       const base::StringPiece domain) const;
 
  private:
+  using EntityIndex = uint16_t;
+
+  struct EntityMappings {
+    EntityMappings();
+    EntityMappings(EntityMappings&&);
+    EntityMappings& operator=(EntityMappings&&);
+    ~EntityMappings();
+
+    std::vector<std::string> entity_names;
+    base::flat_map<std::string, EntityIndex> entity_by_domain;
+    base::flat_map<std::string, EntityIndex> entity_by_root_domain;
+  };
+
+  static EntityMappings ParseMappings(const base::StringPiece entities,
+                                      bool discard_irrelevant);
+  static EntityMappings ParseFromResource(int resource_id);
+
   bool IsInitialized() const { return initialized_; }
-  void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::tuple<base::flat_map<std::string, std::string>,
-                 base::flat_map<std::string, std::string>> entity_mappings);
+  void UpdateMappings(EntityMappings entity_mappings);
 
   bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
+  bool default_load_requested_ = false;
+  EntityMappings mappings_;
 
   base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
 };
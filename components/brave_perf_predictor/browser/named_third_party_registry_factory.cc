@@ -32,9 +32,9 @@ NamedThirdPartyRegistryFactory::~NamedThirdPartyRegistryFactory() {}
 
 KeyedService* NamedThirdPartyRegistryFactory::BuildServiceInstanceFor(
     content::BrowserContext* context) const {
-  auto* registry = new NamedThirdPartyRegistry();
-  registry->InitializeDefault();
-  return registry;
+  // Mappings are loaded on the first blocked resource, see
+  // BandwidthSavingsPredictor::OnSubresourceBlocked.
+  return new NamedThirdPartyRegistry();
 }
 
 bool NamedThirdPartyRegistryFactory::ServiceIsCreatedWithBrowserContext()
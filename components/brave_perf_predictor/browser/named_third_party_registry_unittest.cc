@@ -119,4 +119,22 @@ TEST(NamedThirdPartyRegistryTest, HandlesUnrecognisedThirdPartyTest) {
   EXPECT_FALSE(entity.has_value());
 }
 
+TEST(NamedThirdPartyRegistryTest, DropsClashingRootDomainsTest) {
+  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
+  extractor->LoadMappings(R"([
+    {"name":"First","domains":["a.example.com","b.example.com"]},
+    {"name":"Second","domains":["c.example.com"]},
+    {"name":"Third","domains":["d.example.com"]}
+  ])",
+                          false);
+  auto entity = extractor->GetThirdParty("https://a.example.com");
+  ASSERT_TRUE(entity.has_value());
+  EXPECT_EQ(entity.value(), "First");
+  entity = extractor->GetThirdParty("https://d.example.com");
+  ASSERT_TRUE(entity.has_value());
+  EXPECT_EQ(entity.value(), "Third");
+  // Claimed by several entities, so no root domain match.
+  EXPECT_FALSE(extractor->GetThirdParty("https://x.example.com").has_value());
+}
+
 }  // namespace brave_perf_predictor
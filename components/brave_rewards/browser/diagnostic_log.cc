@@ -0,0 +1,236 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/diagnostic_log.h"
+
+#include <inttypes.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/stringprintf.h"
+#include "brave/components/brave_rewards/browser/file_util.h"
+
+namespace brave_rewards {
+
+namespace {
+
+const char kHeaderMagic[] = "RWDLOG1 ";
+const size_t kHeaderMagicLength = sizeof(kHeaderMagic) - 1;
+const size_t kHeaderValueLength = 16;
+
+// Magic, write offset, space, size and newline
+const int64_t kHeaderSize = kHeaderMagicLength + kHeaderValueLength + 1 +
+    kHeaderValueLength + 1;
+
+const size_t kDividerLength = 80;
+
+bool ParseHeaderValue(
+    const base::StringPiece value,
+    int64_t* out) {
+  DCHECK(out);
+
+  uint64_t parsed_value;
+  if (!base::HexStringToUInt64(value, &parsed_value)) {
+    return false;
+  }
+
+  *out = static_cast<int64_t>(parsed_value);
+  return true;
+}
+
+}  // namespace
+
+DiagnosticLog::DiagnosticLog(
+    const base::FilePath& path,
+    const int64_t capacity)
+    : path_(path),
+      capacity_(capacity) {
+  DCHECK_GT(capacity_, 0);
+}
+
+DiagnosticLog::~DiagnosticLog() = default;
+
+bool DiagnosticLog::Write(
+    const std::string& log_entries) {
+  if (!Open()) {
+    return false;
+  }
+
+  return WriteData(log_entries.data(), log_entries.length());
+}
+
+bool DiagnosticLog::Read(
+    const int num_lines,
+    std::string* value) {
+  DCHECK(value);
+
+  value->clear();
+
+  if (!Open()) {
+    return false;
+  }
+
+  std::string data(size_, '\0');
+
+  // Once the log has wrapped, the oldest byte is the next one to be written
+  const int64_t start = size_ < capacity_ ? 0 : write_offset_;
+  const int64_t first_length = std::min(size_, capacity_ - start);
+  if (first_length > 0 &&
+      file_.Read(kHeaderSize + start, &data[0], first_length) !=
+          first_length) {
+    return false;
+  }
+
+  const int64_t second_length = size_ - first_length;
+  if (second_length > 0 &&
+      file_.Read(kHeaderSize, &data[first_length], second_length) !=
+          second_length) {
+    return false;
+  }
+
+  // The oldest line may have been partially overwritten
+  if (size_ == capacity_) {
+    const size_t line_end = data.find('\n');
+    data.erase(0, line_end == std::string::npos ? line_end : line_end + 1);
+  }
+
+  if (num_lines > 0) {
+    int line_count = 0;
+    for (size_t i = data.length(); i > 0; i--) {
+      if (data[i - 1] == '\n' && ++line_count == num_lines + 1) {
+        data.erase(0, i);
+        break;
+      }
+    }
+  }
+
+  *value = std::move(data);
+
+  return true;
+}
+
+bool DiagnosticLog::Delete() {
+  Close();
+
+  return base::DeleteFile(path_);
+}
+
+void DiagnosticLog::Close() {
+  file_.Close();
+  write_offset_ = 0;
+  size_ = 0;
+}
+
+std::string DiagnosticLog::GetLastError() {
+  return GetLastFileError(&file_);
+}
+
+bool DiagnosticLog::Open() {
+  if (file_.IsValid()) {
+    return true;
+  }
+
+  file_.Initialize(path_, base::File::FLAG_OPEN_ALWAYS |
+      base::File::FLAG_READ | base::File::FLAG_WRITE);
+  if (!file_.IsValid()) {
+    return false;
+  }
+
+  if (!ReadHeader()) {
+    // Either a new file or a log from before the circular format
+    write_offset_ = 0;
+    size_ = 0;
+
+    return file_.SetLength(0) && WriteHeader();
+  }
+
+  if (size_ == 0) {
+    return true;
+  }
+
+  // Separate the entries of this session from the previous ones
+  std::string divider = std::string(kDividerLength, '-');
+  divider += "\n";
+
+  return WriteData(divider.data(), divider.length());
+}
+
+bool DiagnosticLog::ReadHeader() {
+  std::string header(kHeaderSize, '\0');
+  if (file_.Read(0, &header[0], kHeaderSize) != kHeaderSize) {
+    return false;
+  }
+
+  const base::StringPiece header_piece(header);
+  if (header_piece.substr(0, kHeaderMagicLength) != kHeaderMagic ||
+      header_piece.back() != '\n') {
+    return false;
+  }
+
+  int64_t write_offset;
+  int64_t size;
+  if (!ParseHeaderValue(
+          header_piece.substr(kHeaderMagicLength, kHeaderValueLength),
+          &write_offset) ||
+      !ParseHeaderValue(
+          header_piece.substr(kHeaderMagicLength + kHeaderValueLength + 1,
+              kHeaderValueLength),
+          &size)) {
+    return false;
+  }
+
+  // The capacity may have changed since the log was written
+  if (write_offset < 0 || write_offset >= capacity_ || size < 0 ||
+      size > capacity_ || (size < capacity_ && write_offset != size)) {
+    return false;
+  }
+
+  write_offset_ = write_offset;
+  size_ = size;
+
+  return true;
+}
+
+bool DiagnosticLog::WriteHeader() {
+  const std::string header = base::StringPrintf("%s%016" PRIx64 " %016" PRIx64
+      "\n", kHeaderMagic, static_cast<uint64_t>(write_offset_),
+      static_cast<uint64_t>(size_));
+  DCHECK_EQ(static_cast<int64_t>(header.length()), kHeaderSize);
+
+  return file_.Write(0, header.data(), header.length()) ==
+      static_cast<int>(header.length());
+}
+
+bool DiagnosticLog::WriteData(
+    const char* data,
+    int64_t length) {
+  // Only the newest entries fit
+  if (length > capacity_) {
+    data += length - capacity_;
+    length = capacity_;
+  }
+
+  while (length > 0) {
+    const int64_t chunk_length = std::min(length, capacity_ - write_offset_);
+    if (file_.Write(kHeaderSize + write_offset_, data, chunk_length) !=
+        chunk_length) {
+      return false;
+    }
+
+    write_offset_ = (write_offset_ + chunk_length) % capacity_;
+    size_ = std::min(size_ + chunk_length, capacity_);
+    data += chunk_length;
+    length -= chunk_length;
+  }
+
+  return WriteHeader();
+}
+
+}  // namespace brave_rewards
@@ -0,0 +1,68 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DIAGNOSTIC_LOG_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DIAGNOSTIC_LOG_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/time/time.h"
+
+namespace brave_rewards {
+
+struct DiagnosticLogEntry {
+  base::Time time;
+  std::string file;
+  int line = 0;
+  int verbose_level = 0;
+  std::string message;
+};
+
+// Circular diagnostic log file which never grows beyond a fixed capacity and
+// never needs rewriting. The file starts with a small text header holding the
+// offset at which the next entry is written and the number of bytes in use,
+// followed by a data region which entries wrap around once full. Must be used
+// on a sequence that allows blocking.
+class DiagnosticLog {
+ public:
+  DiagnosticLog(const base::FilePath& path, const int64_t capacity);
+  ~DiagnosticLog();
+
+  DiagnosticLog(const DiagnosticLog&) = delete;
+  DiagnosticLog& operator=(const DiagnosticLog&) = delete;
+
+  // Appends |log_entries|, overwriting the oldest entries once full.
+  bool Write(const std::string& log_entries);
+
+  // Reads the last |num_lines| lines, or every line if |num_lines| is -1.
+  bool Read(const int num_lines, std::string* value);
+
+  bool Delete();
+
+  void Close();
+
+  std::string GetLastError();
+
+ private:
+  bool Open();
+  bool ReadHeader();
+  bool WriteHeader();
+  bool WriteData(const char* data, int64_t length);
+
+  const base::FilePath path_;
+  const int64_t capacity_;
+
+  base::File file_;
+  int64_t write_offset_ = 0;
+  int64_t size_ = 0;
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DIAGNOSTIC_LOG_H_
@@ -0,0 +1,93 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/diagnostic_log.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=DiagnosticLogTest.*
+
+namespace brave_rewards {
+
+class DiagnosticLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().AppendASCII("Rewards.log");
+  }
+
+  std::string Read(DiagnosticLog* log, const int num_lines) {
+    std::string value;
+    EXPECT_TRUE(log->Read(num_lines, &value));
+    return value;
+  }
+
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+TEST_F(DiagnosticLogTest, ReadsWrittenEntries) {
+  DiagnosticLog log(path_, 1024);
+  ASSERT_TRUE(log.Write("one\ntwo\n"));
+  ASSERT_TRUE(log.Write("three\n"));
+
+  EXPECT_EQ("one\ntwo\nthree\n", Read(&log, -1));
+  EXPECT_EQ("two\nthree\n", Read(&log, 2));
+}
+
+TEST_F(DiagnosticLogTest, OverwritesOldestEntriesWhenFull) {
+  DiagnosticLog log(path_, 16);
+  ASSERT_TRUE(log.Write("one\ntwo\nthree\n"));
+  ASSERT_TRUE(log.Write("four\nfive\n"));
+
+  // The oldest line may have been partially overwritten, so it is dropped
+  EXPECT_EQ("four\nfive\n", Read(&log, -1));
+
+  int64_t file_size;
+  ASSERT_TRUE(base::GetFileSize(path_, &file_size));
+  const int64_t header_size = file_size - 16;
+  ASSERT_TRUE(log.Write("six\nseven\n"));
+  ASSERT_TRUE(base::GetFileSize(path_, &file_size));
+  EXPECT_EQ(header_size + 16, file_size);
+}
+
+TEST_F(DiagnosticLogTest, SeparatesSessions) {
+  {
+    DiagnosticLog log(path_, 1024);
+    ASSERT_TRUE(log.Write("one\n"));
+  }
+
+  DiagnosticLog log(path_, 1024);
+  ASSERT_TRUE(log.Write("two\n"));
+
+  EXPECT_EQ("one\n" + std::string(80, '-') + "\ntwo\n", Read(&log, -1));
+}
+
+TEST_F(DiagnosticLogTest, ReplacesLogInAnotherFormat) {
+  ASSERT_TRUE(base::WriteFile(path_, "plain text log\n"));
+
+  DiagnosticLog log(path_, 1024);
+  EXPECT_EQ("", Read(&log, -1));
+
+  ASSERT_TRUE(log.Write("one\n"));
+  EXPECT_EQ("one\n", Read(&log, -1));
+}
+
+TEST_F(DiagnosticLogTest, Delete) {
+  DiagnosticLog log(path_, 1024);
+  ASSERT_TRUE(log.Write("one\n"));
+
+  ASSERT_TRUE(log.Delete());
+  EXPECT_FALSE(base::PathExists(path_));
+
+  ASSERT_TRUE(log.Write("two\n"));
+  EXPECT_EQ("two\n", Read(&log, -1));
+}
+
+}  // namespace brave_rewards
@@ -12,15 +12,6 @@
 
 namespace brave_rewards {
 
-bool TailFile(
-    base::File* file,
-    const int num_lines);
-
-bool TailFileAsString(
-    base::File* file,
-    const int num_lines,
-    std::string* value);
-
 std::string GetLastFileError(
     base::File* file);
 
@@ -10,44 +10,11 @@
 #include "base/logging.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
-#include "brave/components/brave_rewards/browser/file_util.h"
 
 namespace brave_rewards {
 
 namespace {
 
-const size_t kDividerLength = 80;
-
-bool CreateLog(
-    base::File* file,
-    const base::FilePath& path) {
-  DCHECK(file);
-
-  file->Initialize(path, base::File::FLAG_CREATE_ALWAYS |
-      base::File::FLAG_READ | base::File::FLAG_WRITE);
-
-  return file->IsValid();
-}
-
-bool OpenLog(
-    base::File* file,
-    const base::FilePath& path) {
-  DCHECK(file);
-
-  file->Initialize(path, base::File::FLAG_OPEN | base::File::FLAG_READ |
-      base::File::FLAG_WRITE);
-
-  return file->IsValid();
-}
-
-void WriteDividerToLog(
-    base::File* file) {
-  std::string divider = std::string(kDividerLength, '-');
-  divider += "\n";
-
-  WriteToLog(file, divider);
-}
-
 std::string GetLogVerboseLevelName(
     const int verbose_level) {
   std::string verbose_level_name;
@@ -81,45 +48,6 @@ std::string TimeFormatForLog(
 
 }  // namespace
 
-bool InitializeLog(
-    base::File* file,
-    const base::FilePath& path) {
-  DCHECK(file);
-
-  if (!base::PathExists(path)) {
-    file->Close();
-    return CreateLog(file, path);
-  }
-
-  if (file->IsValid()) {
-    return true;
-  }
-
-  if (!OpenLog(file, path)) {
-    return false;
-  }
-
-  WriteDividerToLog(file);
-
-  return true;
-}
-
-bool WriteToLog(
-    base::File* file,
-    const std::string& log_entry) {
-  DCHECK(file);
-
-  if (file->Seek(base::File::FROM_END, 0) == -1) {
-    return false;
-  }
-
-  if (file->WriteAtCurrentPos(log_entry.c_str(), log_entry.length()) == -1) {
-    return false;
-  }
-
-  return true;
-}
-
 std::string FriendlyFormatLogEntry(
     const base::Time& time,
     const std::string& file,
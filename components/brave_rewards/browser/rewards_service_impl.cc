@@ -41,7 +41,6 @@
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
 #include "brave/components/brave_ads/browser/buildflags/buildflags.h"
 #include "brave/components/brave_rewards/browser/android_util.h"
-#include "brave/components/brave_rewards/browser/file_util.h"
 #include "brave/components/brave_rewards/browser/logging.h"
 #include "brave/components/brave_rewards/browser/logging_util.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service.h"
@@ -96,10 +95,34 @@ static const unsigned int kRetriesCountOnNetworkChange = 1;
 namespace {
 
 const int kDiagnosticLogMaxVerboseLevel = 6;
-const int kTailDiagnosticLogToNumLines = 20000;
 const int kDiagnosticLogMaxFileSize = 10 * (1024 * 1024);
+const size_t kDiagnosticLogMaxBufferedEntries = 256;
+constexpr base::TimeDelta kDiagnosticLogFlushDelay =
+    base::TimeDelta::FromSeconds(5);
 const char pref_prefix[] = "brave.rewards";
 
+// Does not use the service, which may be destroyed by the time this runs
+bool WriteToDiagnosticLogOnFileTaskRunner(
+    brave_rewards::DiagnosticLog* diagnostic_log,
+    const std::vector<DiagnosticLogEntry>& entries) {
+  DCHECK(diagnostic_log);
+
+  std::string log_entries;
+  for (const auto& entry : entries) {
+    log_entries += FriendlyFormatLogEntry(entry.time, entry.file, entry.line,
+        entry.verbose_level, entry.message);
+  }
+
+  if (!diagnostic_log->Write(log_entries)) {
+    VLOG(0) << "Failed to write to diagnostic log: "
+        << diagnostic_log->GetLastError();
+
+    return false;
+  }
+
+  return true;
+}
+
 std::string URLMethodToRequestType(ledger::type::UrlMethod method) {
   switch (method) {
     case ledger::type::UrlMethod::GET:
@@ -303,6 +326,10 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
            base::TaskPriority::USER_VISIBLE,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       diagnostic_log_path_(profile_->GetPath().Append(kDiagnosticLogPath)),
+      diagnostic_log_(std::make_unique<brave_rewards::DiagnosticLog>(
+          diagnostic_log_path_,
+          kDiagnosticLogMaxFileSize)),
+      diagnostic_log_flush_timer_(std::make_unique<base::OneShotTimer>()),
       ledger_state_path_(profile_->GetPath().Append(kLedger_state)),
       publisher_state_path_(profile_->GetPath().Append(kPublisher_state)),
       publisher_info_db_path_(profile->GetPath().Append(kPublisher_info_db)),
@@ -319,6 +346,8 @@ RewardsServiceImpl::~RewardsServiceImpl() {
   if (ledger_database_) {
     file_task_runner_->DeleteSoon(FROM_HERE, ledger_database_.release());
   }
+  FlushDiagnosticLog();
+  file_task_runner_->DeleteSoon(FROM_HERE, diagnostic_log_.release());
   StopNotificationTimers();
 }
 
@@ -739,6 +768,13 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
     return;
   }
 
+  // Most loads on a page are not media pings, so drop them here before
+  // parsing the query and crossing into the utility process.
+  if (!ledger::Ledger::IsMediaXHRLink(url.spec(), first_party_url.spec(),
+                                      referrer.spec())) {
+    return;
+  }
+
   base::flat_map<std::string, std::string> parts;
 
   for (net::QueryIterator it(url); !it.IsAtEnd(); it.Advance()) {
@@ -1381,7 +1417,7 @@ void RewardsServiceImpl::OnStopLedgerForCompleteReset(
 
 bool RewardsServiceImpl::ResetOnFilesTaskRunner() {
   // Close any open files before deleting them (required on Windows)
-  diagnostic_log_.Close();
+  diagnostic_log_->Close();
 
   const std::vector<base::FilePath> paths = {
     ledger_state_path_,
@@ -2239,32 +2275,6 @@ void RewardsServiceImpl::ShowNotificationTipsPaid(bool ac_enabled) {
       "rewards_notification_tips_processed");
 }
 
-bool RewardsServiceImpl::MaybeTailDiagnosticLog(
-    const int num_lines) {
-  if (!diagnostic_log_.IsValid()) {
-    return false;
-  }
-
-  static bool first_run = true;
-
-  const int64_t length = diagnostic_log_.GetLength();
-  if (length == -1) {
-    return false;
-  }
-
-  if (!first_run && length <= kDiagnosticLogMaxFileSize) {
-    return true;
-  }
-
-  first_run = false;
-
-  if (!TailFile(&diagnostic_log_, num_lines)) {
-    return false;
-  }
-
-  return true;
-}
-
 void RewardsServiceImpl::DiagnosticLog(
     const std::string& file,
     const int line,
@@ -2282,52 +2292,43 @@ void RewardsServiceImpl::DiagnosticLog(
     return;
   }
 
-  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner,
-          base::Unretained(this),
-          diagnostic_log_path_,
-          kTailDiagnosticLogToNumLines,
-          file,
-          line,
-          verbose_level,
-          message),
-      base::BindOnce(&RewardsServiceImpl::OnWriteToLogOnFileTaskRunner,
-          AsWeakPtr()));
-}
-
-bool RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& log_path,
-    const int num_lines,
-    const std::string& file,
-    const int line,
-    const int verbose_level,
-    const std::string& message) {
-  if (!InitializeLog(&diagnostic_log_, log_path)) {
-    VLOG(0) << "Failed to initialize diagnostic log: "
-        << GetLastFileError(&diagnostic_log_);
+  DiagnosticLogEntry entry;
+  entry.time = base::Time::Now();
+  entry.file = file;
+  entry.line = line;
+  entry.verbose_level = verbose_level;
+  entry.message = message;
+  diagnostic_log_entries_.push_back(std::move(entry));
 
-    return false;
+  // Entries are written in batches rather than one file task per entry
+  if (diagnostic_log_entries_.size() >= kDiagnosticLogMaxBufferedEntries) {
+    FlushDiagnosticLog();
+    return;
   }
 
-  const base::Time time = base::Time::Now();
-
-  const std::string log_entry =
-      FriendlyFormatLogEntry(time, file, line, verbose_level, message);
-
-  if (!WriteToLog(&diagnostic_log_, log_entry)) {
-    VLOG(0) << "Failed to write to diagnostic log: "
-        << GetLastFileError(&diagnostic_log_);
-
-    return false;
+  if (!diagnostic_log_flush_timer_->IsRunning()) {
+    diagnostic_log_flush_timer_->Start(FROM_HERE, kDiagnosticLogFlushDelay,
+        base::BindOnce(&RewardsServiceImpl::FlushDiagnosticLog,
+            base::Unretained(this)));
   }
+}
 
-  if (!MaybeTailDiagnosticLog(num_lines)) {
-    VLOG(0) << "Failed to vacuum diagnostic log";
+void RewardsServiceImpl::FlushDiagnosticLog() {
+  diagnostic_log_flush_timer_->Stop();
 
-    return false;
+  if (diagnostic_log_entries_.empty()) {
+    return;
   }
 
-  return true;
+  std::vector<DiagnosticLogEntry> entries;
+  entries.swap(diagnostic_log_entries_);
+
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&WriteToDiagnosticLogOnFileTaskRunner,
+          base::Unretained(diagnostic_log_.get()),
+          std::move(entries)),
+      base::BindOnce(&RewardsServiceImpl::OnWriteToLogOnFileTaskRunner,
+          AsWeakPtr()));
 }
 
 void RewardsServiceImpl::OnWriteToLogOnFileTaskRunner(
@@ -2338,10 +2339,12 @@ void RewardsServiceImpl::OnWriteToLogOnFileTaskRunner(
 void RewardsServiceImpl::LoadDiagnosticLog(
       const int num_lines,
       LoadDiagnosticLogCallback callback) {
+  // Include entries which have not been written yet
+  FlushDiagnosticLog();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner,
           base::Unretained(this),
-          diagnostic_log_path_,
           num_lines),
       base::BindOnce(&RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner,
           AsWeakPtr(),
@@ -2349,16 +2352,15 @@ void RewardsServiceImpl::LoadDiagnosticLog(
 }
 
 std::string RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& path,
     const int num_lines) {
-  if (!base::PathExists(path)) {
+  if (!base::PathExists(diagnostic_log_path_)) {
     return "";
   }
 
   std::string value;
-  if (!TailFileAsString(&diagnostic_log_, num_lines, &value)) {
+  if (!diagnostic_log_->Read(num_lines, &value)) {
     return base::StringPrintf("ERROR: %s",
-        GetLastFileError(&diagnostic_log_).c_str());
+        diagnostic_log_->GetLastError().c_str());
   }
 
   return value;
@@ -2372,24 +2374,19 @@ void RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner(
 
 void RewardsServiceImpl::ClearDiagnosticLog(
     ClearDiagnosticLogCallback callback) {
+  diagnostic_log_flush_timer_->Stop();
+  diagnostic_log_entries_.clear();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner,
-          base::Unretained(this),
-          diagnostic_log_path_),
+          base::Unretained(this)),
       base::BindOnce(&RewardsServiceImpl::OnClearDiagnosticLogOnFileTaskRunner,
           AsWeakPtr(),
           std::move(callback)));
 }
 
-bool RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& path) {
-  if (!base::PathExists(path)) {
-    return true;
-  }
-
-  diagnostic_log_.Close();
-
-  return base::DeleteFile(path);
+bool RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner() {
+  return diagnostic_log_->Delete();
 }
 
 void RewardsServiceImpl::OnClearDiagnosticLogOnFileTaskRunner(
@@ -3327,6 +3324,8 @@ void RewardsServiceImpl::ClearAllNotifications() {
 
 void RewardsServiceImpl::CompleteReset(SuccessCallback callback) {
   resetting_rewards_ = true;
+  diagnostic_log_flush_timer_->Stop();
+  diagnostic_log_entries_.clear();
 
   auto* ads_service = brave_ads::AdsServiceFactory::GetForProfile(profile_);
   if (ads_service) {
@@ -3373,7 +3372,9 @@ void RewardsServiceImpl::WalletDisconnected(const std::string& wallet_type) {
 }
 
 void RewardsServiceImpl::DeleteLog(ledger::ResultCallback callback) {
-  diagnostic_log_.Close();
+  diagnostic_log_flush_timer_->Stop();
+  diagnostic_log_entries_.clear();
+
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -3387,7 +3388,7 @@ void RewardsServiceImpl::DeleteLog(ledger::ResultCallback callback) {
 }
 
 bool RewardsServiceImpl::DeleteLogTaskRunner() {
-  return base::DeleteFile(diagnostic_log_path_);
+  return diagnostic_log_->Delete();
 }
 
 void RewardsServiceImpl::OnDeleteLog(
@@ -15,7 +15,6 @@
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
-#include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
@@ -23,6 +22,7 @@
 #include "base/values.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/ledger_client.h"
+#include "brave/components/brave_rewards/browser/diagnostic_log.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
 #include "brave/components/brave_rewards/browser/rewards_service_private_observer.h"
 #include "brave/components/greaselion/browser/buildflags/buildflags.h"
@@ -577,22 +577,13 @@ class RewardsServiceImpl : public RewardsService,
       SavePublisherInfoCallback callback,
       const ledger::type::Result result);
 
-  bool MaybeTailDiagnosticLog(
-      const int num_lines);
-
   void DiagnosticLog(
       const std::string& file,
       const int line,
       const int verbose_level,
       const std::string& message) override;
 
-  bool WriteToDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& log_path,
-      const int num_lines,
-      const std::string& file,
-      const int line,
-      const int verbose_level,
-      const std::string& message);
+  void FlushDiagnosticLog();
 
   void OnWriteToLogOnFileTaskRunner(
     const bool success);
@@ -602,7 +593,6 @@ class RewardsServiceImpl : public RewardsService,
       LoadDiagnosticLogCallback callback) override;
 
   std::string LoadDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& path,
       const int num_lines);
 
   void OnLoadDiagnosticLogOnFileTaskRunner(
@@ -613,8 +603,7 @@ class RewardsServiceImpl : public RewardsService,
 
   void CompleteReset(SuccessCallback callback) override;
 
-  bool ClearDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& path);
+  bool ClearDiagnosticLogOnFileTaskRunner();
 
   void OnClearDiagnosticLogOnFileTaskRunner(
       ClearDiagnosticLogCallback callback,
@@ -784,7 +773,9 @@ class RewardsServiceImpl : public RewardsService,
   mojo::Remote<bat_ledger::mojom::BatLedgerService> bat_ledger_service_;
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   const base::FilePath diagnostic_log_path_;
-  base::File diagnostic_log_;
+  std::unique_ptr<brave_rewards::DiagnosticLog> diagnostic_log_;
+  std::vector<DiagnosticLogEntry> diagnostic_log_entries_;
+  std::unique_ptr<base::OneShotTimer> diagnostic_log_flush_timer_;
   const base::FilePath ledger_state_path_;
   const base::FilePath publisher_state_path_;
   const base::FilePath publisher_info_db_path_;
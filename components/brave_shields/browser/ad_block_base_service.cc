@@ -6,6 +6,7 @@
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <utility>
 #include <vector>
@@ -34,6 +35,8 @@ using namespace net::registry_controlled_domains;  // NOLINT
 
 namespace {
 
+std::atomic<uint64_t> g_filter_list_version{1};
+
 std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
   std::string filter_option = "";
   switch (resource_type) {
@@ -104,6 +107,23 @@ std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
 
 namespace brave_shields {
 
+// Determine third-party here so the library doesn't need to figure it out.
+// CreateFromNormalizedTuple is needed because SameDomainOrHost needs
+// a URL or origin and not a string to a host name.
+AdBlockRequest::AdBlockRequest(const GURL& url,
+                               blink::mojom::ResourceType resource_type,
+                               const std::string& tab_host)
+    : url(url.spec()),
+      host(url.host()),
+      tab_host(tab_host),
+      resource_type(ResourceTypeToString(resource_type)),
+      is_third_party(!SameDomainOrHost(
+          url,
+          url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
+          INCLUDE_PRIVATE_REGISTRIES)) {}
+
+AdBlockRequest::~AdBlockRequest() = default;
+
 AdBlockBaseService::AdBlockBaseService(BraveComponent::Delegate* delegate)
     : BaseBraveShieldsService(delegate),
       ad_block_client_(new adblock::Engine()),
@@ -121,19 +141,20 @@ void AdBlockBaseService::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  MatchRequest(AdBlockRequest(url, resource_type, tab_host), did_match_rule,
+               did_match_exception, did_match_important, mock_data_url);
+}
 
-  // Determine third-party here so the library doesn't need to figure it out.
-  // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
-  // a URL or origin and not a string to a host name.
-  bool is_third_party = !SameDomainOrHost(
-      url,
-      url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
-      INCLUDE_PRIVATE_REGISTRIES);
+void AdBlockBaseService::MatchRequest(const AdBlockRequest& request,
+                                      bool* did_match_rule,
+                                      bool* did_match_exception,
+                                      bool* did_match_important,
+                                      std::string* mock_data_url) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
   ad_block_client_->matches(
-      url.spec(), url.host(), tab_host, is_third_party,
-      ResourceTypeToString(resource_type), did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+      request.url, request.host, request.tab_host, request.is_third_party,
+      request.resource_type, did_match_rule, did_match_exception,
+      did_match_important, mock_data_url);
 
   // LOG(ERROR) << "AdBlockBaseService::ShouldStartRequest(), host: "
   //  << tab_host
@@ -160,6 +181,7 @@ void AdBlockBaseService::EnableTag(const std::string& tag, bool enabled) {
       tags_.erase(it);
     }
   }
+  IncrementFilterListVersion();
 }
 
 void AdBlockBaseService::AddResources(const std::string& resources) {
@@ -193,28 +215,38 @@ base::Optional<base::Value> AdBlockBaseService::HiddenClassIdSelectors(
       ad_block_client_->hiddenClassIdSelectors(classes, ids, exceptions));
 }
 
+// static
+uint64_t AdBlockBaseService::GetFilterListVersion() {
+  return g_filter_list_version.load();
+}
+
+// static
+void AdBlockBaseService::IncrementFilterListVersion() {
+  g_filter_list_version++;
+}
+
 void AdBlockBaseService::GetDATFileData(const base::FilePath& dat_file_path) {
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::ThreadPool(), base::MayBlock()},
-      base::BindOnce(&brave_component_updater::LoadDATFileData<adblock::Engine>,
+      base::BindOnce(&brave_component_updater::LoadDATFileDataFromMappedFile<
+                         adblock::Engine>,
                      dat_file_path),
       base::BindOnce(&AdBlockBaseService::OnGetDATFileData,
                      weak_factory_.GetWeakPtr()));
 }
 
-void AdBlockBaseService::OnGetDATFileData(GetDATFileDataResult result) {
-  if (result.second.empty()) {
-    LOG(ERROR) << "Could not obtain ad block data";
-    return;
-  }
-  if (!result.first.get()) {
-    LOG(ERROR) << "Failed to deserialize ad block data";
+void AdBlockBaseService::OnGetDATFileData(
+    std::unique_ptr<adblock::Engine> ad_block_client) {
+  if (!ad_block_client) {
+    LOG(ERROR) << "Failed to load ad block data";
     return;
   }
+  // The engine is swapped in on the task runner that does the matching, so
+  // requests see either the old engine or the new one, never a partial one.
   GetTaskRunner()->PostTask(
       FROM_HERE, base::BindOnce(&AdBlockBaseService::UpdateAdBlockClient,
                                 base::Unretained(this),
-                                std::move(result.first)));
+                                std::move(ad_block_client)));
 }
 
 void AdBlockBaseService::UpdateAdBlockClient(
@@ -223,6 +255,7 @@ void AdBlockBaseService::UpdateAdBlockClient(
   ad_block_client_ = std::move(ad_block_client);
   AddKnownTagsToAdBlockInstance();
   AddKnownResourcesToAdBlockInstance();
+  IncrementFilterListVersion();
 }
 
 void AdBlockBaseService::AddKnownTagsToAdBlockInstance() {
@@ -249,6 +282,7 @@ void AdBlockBaseService::ResetForTest(const std::string& rules,
     resources_ = resources;
   }
   AddKnownResourcesToAdBlockInstance();
+  IncrementFilterListVersion();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
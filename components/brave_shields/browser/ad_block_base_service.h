@@ -30,13 +30,29 @@ class Engine;
 
 namespace brave_shields {
 
+// The inputs of adblock matching that only depend on the request. They are
+// the same for every filter list, so they are computed once per request and
+// shared by the default, regional and custom filter engines.
+struct AdBlockRequest {
+  AdBlockRequest(const GURL& url,
+                 blink::mojom::ResourceType resource_type,
+                 const std::string& tab_host);
+  ~AdBlockRequest();
+
+  AdBlockRequest(const AdBlockRequest&) = delete;
+  AdBlockRequest& operator=(const AdBlockRequest&) = delete;
+
+  const std::string url;
+  const std::string host;
+  const std::string tab_host;
+  const std::string resource_type;
+  const bool is_third_party;
+};
+
 // The base class of the brave shields service in charge of ad-block
 // checking and init.
 class AdBlockBaseService : public BaseBraveShieldsService {
  public:
-  using GetDATFileDataResult =
-      brave_component_updater::LoadDATFileDataResult<adblock::Engine>;
-
   explicit AdBlockBaseService(BraveComponent::Delegate* delegate);
   ~AdBlockBaseService() override;
 
@@ -47,6 +63,12 @@ class AdBlockBaseService : public BaseBraveShieldsService {
                           bool* did_match_exception,
                           bool* did_match_important,
                           std::string* mock_data_url) override;
+  // Matches a request against this service's own engine only.
+  void MatchRequest(const AdBlockRequest& request,
+                    bool* did_match_rule,
+                    bool* did_match_exception,
+                    bool* did_match_important,
+                    std::string* mock_data_url);
   void AddResources(const std::string& resources);
   void EnableTag(const std::string& tag, bool enabled);
   bool TagExists(const std::string& tag);
@@ -58,6 +80,12 @@ class AdBlockBaseService : public BaseBraveShieldsService {
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions);
 
+  // Returns a number that changes whenever the rules of any ad-block engine
+  // change, so that cached matching results can be dropped. Can be called
+  // from any thread.
+  static uint64_t GetFilterListVersion();
+  static void IncrementFilterListVersion();
+
  protected:
   friend class ::AdBlockServiceTest;
   bool Init() override;
@@ -72,7 +100,7 @@ class AdBlockBaseService : public BaseBraveShieldsService {
  private:
   void UpdateAdBlockClient(
       std::unique_ptr<adblock::Engine> ad_block_client);
-  void OnGetDATFileData(GetDATFileDataResult result);
+  void OnGetDATFileData(std::unique_ptr<adblock::Engine> ad_block_client);
   void OnPreferenceChanges(const std::string& pref_name);
 
   std::vector<std::string> tags_;
@@ -57,6 +57,7 @@ void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
     const std::string& custom_filters) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
   ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  IncrementFilterListVersion();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
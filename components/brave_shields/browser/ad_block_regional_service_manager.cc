@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/callback_helpers.h"
 #include "base/strings/string_util.h"
 #include "base/task/post_task.h"
 #include "base/values.h"
@@ -30,7 +31,9 @@ namespace brave_shields {
 AdBlockRegionalServiceManager::AdBlockRegionalServiceManager(
     brave_component_updater::BraveComponent::Delegate* delegate)
     : delegate_(delegate),
-      initialized_(false) {
+      initialized_(false),
+      regional_services_snapshot_(
+          base::MakeRefCounted<RegionalServicesSnapshot>()) {
 }
 
 AdBlockRegionalServiceManager::~AdBlockRegionalServiceManager() {
@@ -69,7 +72,6 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
   }
 
   // Start all regional services associated with enabled filter lists
-  base::AutoLock lock(regional_services_lock_);
   const base::DictionaryValue* regional_filters_dict =
       local_state->GetDictionary(kAdBlockRegionalFilters);
   for (base::DictionaryValue::Iterator it(*regional_filters_dict);
@@ -92,6 +94,7 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
       }
     }
   }
+  PublishRegionalServicesSnapshot();
 
   initialized_ = true;
 }
@@ -110,33 +113,66 @@ void AdBlockRegionalServiceManager::UpdateFilterListPrefs(
   regional_filters_dict->Set(uuid, std::move(regional_filter_dict));
 }
 
+scoped_refptr<AdBlockRegionalServiceManager::RegionalServicesSnapshot>
+AdBlockRegionalServiceManager::GetRegionalServicesSnapshot() const {
+  base::AutoLock lock(regional_services_snapshot_lock_);
+  return regional_services_snapshot_;
+}
+
+void AdBlockRegionalServiceManager::PublishRegionalServicesSnapshot() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  auto snapshot = base::MakeRefCounted<RegionalServicesSnapshot>();
+  snapshot->data.reserve(regional_services_.size());
+  for (const auto& regional_service : regional_services_) {
+    snapshot->data.push_back(regional_service.second.get());
+  }
+
+  {
+    base::AutoLock lock(regional_services_snapshot_lock_);
+    regional_services_snapshot_ = std::move(snapshot);
+  }
+  // Bumped after publishing, so that results matched against the previous
+  // snapshot are never cached under the new version.
+  AdBlockBaseService::IncrementFilterListVersion();
+}
+
+void AdBlockRegionalServiceManager::DeleteRegionalServiceSoon(
+    std::unique_ptr<AdBlockRegionalService> regional_service) {
+  // Matching runs on the service task runner, so once a task posted there
+  // has run no earlier snapshot can still be using the service
+  auto task_runner = regional_service->GetTaskRunner();
+  task_runner->PostTaskAndReply(
+      FROM_HERE, base::DoNothing(),
+      base::BindOnce(
+          [](std::unique_ptr<AdBlockRegionalService> regional_service) {},
+          std::move(regional_service)));
+}
+
 bool AdBlockRegionalServiceManager::IsInitialized() const {
   return initialized_;
 }
 
 bool AdBlockRegionalServiceManager::Start() {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
-    regional_service.second->Start();
+  auto regional_services = GetRegionalServicesSnapshot();
+  for (auto* regional_service : regional_services->data) {
+    regional_service->Start();
   }
 
   return true;
 }
 
 void AdBlockRegionalServiceManager::ShouldStartRequest(
-    const GURL& url,
-    blink::mojom::ResourceType resource_type,
-    const std::string& tab_host,
+    const AdBlockRequest& request,
     bool* did_match_rule,
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
-  base::AutoLock lock(regional_services_lock_);
+  auto regional_services = GetRegionalServicesSnapshot();
 
-  for (const auto& regional_service : regional_services_) {
-    regional_service.second->ShouldStartRequest(
-        url, resource_type, tab_host, did_match_rule, did_match_exception,
-        did_match_important, mock_data_url);
+  for (auto* regional_service : regional_services->data) {
+    regional_service->MatchRequest(request, did_match_rule,
+                                   did_match_exception,
+                                   did_match_important, mock_data_url);
     if (did_match_important && *did_match_important) {
       return;
     }
@@ -145,29 +181,30 @@ void AdBlockRegionalServiceManager::ShouldStartRequest(
 
 void AdBlockRegionalServiceManager::EnableTag(const std::string& tag,
                                               bool enabled) {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
-    regional_service.second->EnableTag(tag, enabled);
+  auto regional_services = GetRegionalServicesSnapshot();
+  for (auto* regional_service : regional_services->data) {
+    regional_service->EnableTag(tag, enabled);
   }
 }
 
 void AdBlockRegionalServiceManager::AddResources(
     const std::string& resources) {
-  base::AutoLock lock(regional_services_lock_);
-  for (const auto& regional_service : regional_services_) {
-    regional_service.second->AddResources(resources);
+  auto regional_services = GetRegionalServicesSnapshot();
+  for (auto* regional_service : regional_services->data) {
+    regional_service->AddResources(resources);
   }
 }
 
 void AdBlockRegionalServiceManager::EnableFilterList(
     const std::string& uuid, bool enabled) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   DCHECK(!uuid.empty());
   auto catalog_entry = brave_shields::FindAdBlockFilterListByUUID(
       regional_catalog_, uuid);
 
-  // Enable or disable the specified filter list
+  // Enable or disable the specified filter list. Matching keeps using the
+  // previous snapshot until the new one is published.
   if (initialized_) {
-    base::AutoLock lock(regional_services_lock_);
     DCHECK(catalog_entry != regional_catalog_.end());
     auto it = regional_services_.find(uuid);
     if (enabled) {
@@ -177,10 +214,15 @@ void AdBlockRegionalServiceManager::EnableFilterList(
       regional_service->Start();
       regional_services_.insert(
           std::make_pair(uuid, std::move(regional_service)));
+      PublishRegionalServicesSnapshot();
     } else {
       DCHECK(it != regional_services_.end());
-      it->second->Unregister();
+      std::unique_ptr<AdBlockRegionalService> regional_service =
+          std::move(it->second);
       regional_services_.erase(it);
+      PublishRegionalServicesSnapshot();
+      regional_service->Unregister();
+      DeleteRegionalServiceSoon(std::move(regional_service));
     }
   }
 
@@ -195,17 +237,17 @@ void AdBlockRegionalServiceManager::EnableFilterList(
 base::Optional<base::Value>
 AdBlockRegionalServiceManager::UrlCosmeticResources(
         const std::string& url) {
-  base::AutoLock lock(regional_services_lock_);
-  auto it = regional_services_.begin();
-  if (it == regional_services_.end()) {
+  auto regional_services = GetRegionalServicesSnapshot();
+  auto it = regional_services->data.begin();
+  if (it == regional_services->data.end()) {
     return base::Optional<base::Value>();
   }
   base::Optional<base::Value> first_value =
-      it->second->UrlCosmeticResources(url);
+      (*it)->UrlCosmeticResources(url);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for (++it; it != regional_services->data.end(); it++) {
     base::Optional<base::Value> next_value =
-        it->second->UrlCosmeticResources(url);
+        (*it)->UrlCosmeticResources(url);
     if (first_value) {
       if (next_value) {
         MergeResourcesInto(std::move(*next_value), &*first_value, false);
@@ -223,17 +265,17 @@ AdBlockRegionalServiceManager::HiddenClassIdSelectors(
         const std::vector<std::string>& classes,
         const std::vector<std::string>& ids,
         const std::vector<std::string>& exceptions) {
-  base::AutoLock lock(regional_services_lock_);
-  auto it = regional_services_.begin();
-  if (it == regional_services_.end()) {
+  auto regional_services = GetRegionalServicesSnapshot();
+  auto it = regional_services->data.begin();
+  if (it == regional_services->data.end()) {
     return base::Optional<base::Value>();
   }
   base::Optional<base::Value> first_value =
-      it->second->HiddenClassIdSelectors(classes, ids, exceptions);
+      (*it)->HiddenClassIdSelectors(classes, ids, exceptions);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for (++it; it != regional_services->data.end(); it++) {
     base::Optional<base::Value> next_value =
-        it->second->HiddenClassIdSelectors(classes, ids, exceptions);
+        (*it)->HiddenClassIdSelectors(classes, ids, exceptions);
     if (first_value && first_value->is_list()) {
       if (next_value && next_value->is_list()) {
         for (auto i = next_value->GetList().begin();
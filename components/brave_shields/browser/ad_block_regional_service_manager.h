@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/macros.h"
+#include "base/memory/ref_counted.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/optional.h"
 #include "base/synchronization/lock.h"
@@ -32,6 +33,7 @@ using brave_component_updater::BraveComponent;
 namespace brave_shields {
 
 class AdBlockRegionalService;
+struct AdBlockRequest;
 
 // The AdBlock regional service manager, in charge of initializing and
 // managing regional AdBlock clients.
@@ -47,9 +49,7 @@ class AdBlockRegionalServiceManager {
 
   bool IsInitialized() const;
   bool Start();
-  void ShouldStartRequest(const GURL& url,
-                          blink::mojom::ResourceType resource_type,
-                          const std::string& tab_host,
+  void ShouldStartRequest(const AdBlockRequest& request,
                           bool* did_match_rule,
                           bool* did_match_exception,
                           bool* did_match_important,
@@ -67,15 +67,27 @@ class AdBlockRegionalServiceManager {
 
  private:
   friend class ::AdBlockServiceTest;
+  // The started regional services, ordered by UUID. A snapshot is never
+  // modified once published, so it can be used without holding a lock.
+  using RegionalServicesSnapshot =
+      base::RefCountedData<std::vector<AdBlockRegionalService*>>;
+
   bool Init();
   void StartRegionalServices();
   void UpdateFilterListPrefs(const std::string& uuid, bool enabled);
+  scoped_refptr<RegionalServicesSnapshot> GetRegionalServicesSnapshot() const;
+  void PublishRegionalServicesSnapshot();
+  void DeleteRegionalServiceSoon(
+      std::unique_ptr<AdBlockRegionalService> regional_service);
 
   brave_component_updater::BraveComponent::Delegate* delegate_;  // NOT OWNED
   bool initialized_;
-  base::Lock regional_services_lock_;
+  // Only changed on the UI thread. Matching uses the published snapshot.
   std::map<std::string, std::unique_ptr<AdBlockRegionalService>>
       regional_services_;
+  // Only held while the snapshot pointer is read or replaced.
+  mutable base::Lock regional_services_snapshot_lock_;
+  scoped_refptr<RegionalServicesSnapshot> regional_services_snapshot_;
 
   std::vector<adblock::FilterList> regional_catalog_;
 
@@ -31,10 +31,15 @@
 #define DAT_FILE "rs-ABPFilterParserData.dat"
 #define REGIONAL_CATALOG "regional_catalog.json"
 
+using cosmetic_filters::HiddenClassIdSelectorsCache;
+
 namespace brave_shields {
 
 namespace {
 
+// Class and id names seen across all pages, most of which hide nothing.
+const size_t kHiddenClassIdSelectorsCacheSize = 10000;
+
 std::string GetTagFromPrefName(const std::string& pref_name) {
   if (pref_name == kFBEmbedControlType) {
     return brave_shields::kFacebookEmbeds;
@@ -81,23 +86,26 @@ void AdBlockService::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
-  AdBlockBaseService::ShouldStartRequest(
-      url, resource_type, tab_host, did_match_rule, did_match_exception,
-      did_match_important, mock_data_url);
+  // Prepare the request once for all the enabled lists rather than once per
+  // list.
+  const AdBlockRequest request(url, resource_type, tab_host);
+
+  MatchRequest(request, did_match_rule, did_match_exception,
+               did_match_important, mock_data_url);
   if (did_match_important && *did_match_important) {
     return;
   }
 
   regional_service_manager()->ShouldStartRequest(
-      url, resource_type, tab_host, did_match_rule, did_match_exception,
-      did_match_important, mock_data_url);
+      request, did_match_rule, did_match_exception, did_match_important,
+      mock_data_url);
   if (did_match_important && *did_match_important) {
     return;
   }
 
-  custom_filters_service()->ShouldStartRequest(
-      url, resource_type, tab_host, did_match_rule, did_match_exception,
-      did_match_important, mock_data_url);
+  custom_filters_service()->MatchRequest(request, did_match_rule,
+                                         did_match_exception,
+                                         did_match_important, mock_data_url);
 }
 
 base::Optional<base::Value> AdBlockService::UrlCosmeticResources(
@@ -157,12 +165,78 @@ base::Optional<base::Value> AdBlockService::HiddenClassIdSelectors(
   if (!hide_selectors || !hide_selectors->is_list())
     hide_selectors = base::ListValue();
 
-  if (custom_selectors && custom_selectors->is_list())
-    hide_selectors->Append(std::move(*custom_selectors));
+  if (custom_selectors && custom_selectors->is_list()) {
+    for (auto& selector : custom_selectors->GetList())
+      hide_selectors->Append(std::move(selector));
+  }
 
   return hide_selectors;
 }
 
+std::pair<HiddenClassIdSelectorsCache::SelectorsMap, uint64_t>
+AdBlockService::HiddenClassIdSelectorsByName(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  // Read before matching, so that a concurrent list change can only make
+  // these results be dropped early, never kept too long.
+  const uint64_t version = GetFilterListVersion();
+  hidden_class_id_selectors_cache_.SetVersion(version);
+
+  HiddenClassIdSelectorsCache::SelectorsMap selectors;
+  std::vector<std::string> missing_classes;
+  std::vector<std::string> missing_ids;
+  hidden_class_id_selectors_cache_.Lookup(classes, ids, &selectors,
+                                          &missing_classes, &missing_ids);
+  if (missing_classes.empty() && missing_ids.empty())
+    return {std::move(selectors), version};
+
+  HiddenClassIdSelectorsCache::SelectorsMap matched;
+  if (!HiddenClassIdSelectorsCache::GroupSelectors(
+          missing_classes, missing_ids,
+          MatchHiddenClassIdSelectors(missing_classes, missing_ids),
+          &matched)) {
+    // Some selector can't be told apart by its first name, so match the
+    // names one at a time instead.
+    matched.clear();
+    for (const auto& name : missing_classes) {
+      auto name_selectors = MatchHiddenClassIdSelectors({name}, {});
+      if (!name_selectors.empty()) {
+        matched[HiddenClassIdSelectorsCache::ClassKey(name)] =
+            std::move(name_selectors);
+      }
+    }
+    for (const auto& name : missing_ids) {
+      auto name_selectors = MatchHiddenClassIdSelectors({}, {name});
+      if (!name_selectors.empty()) {
+        matched[HiddenClassIdSelectorsCache::IdKey(name)] =
+            std::move(name_selectors);
+      }
+    }
+  }
+  hidden_class_id_selectors_cache_.Put(missing_classes, missing_ids, matched);
+
+  for (auto& entry : matched)
+    selectors[entry.first] = std::move(entry.second);
+  return {std::move(selectors), version};
+}
+
+std::vector<std::string> AdBlockService::MatchHiddenClassIdSelectors(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids) {
+  std::vector<std::string> selectors;
+  // Exceptions depend on the page, so they are applied by the caller.
+  base::Optional<base::Value> hide_selectors =
+      HiddenClassIdSelectors(classes, ids, std::vector<std::string>());
+  if (!hide_selectors || !hide_selectors->is_list())
+    return selectors;
+  for (const auto& selector : hide_selectors->GetList()) {
+    if (selector.is_string())
+      selectors.push_back(selector.GetString());
+  }
+  return selectors;
+}
+
 AdBlockRegionalServiceManager* AdBlockService::regional_service_manager() {
   if (!regional_service_manager_)
     regional_service_manager_ =
@@ -181,7 +255,9 @@ AdBlockService::custom_filters_service() {
 
 AdBlockService::AdBlockService(
     brave_component_updater::BraveComponent::Delegate* delegate)
-    : AdBlockBaseService(delegate), component_delegate_(delegate) {}
+    : AdBlockBaseService(delegate),
+      component_delegate_(delegate),
+      hidden_class_id_selectors_cache_(kHiddenClassIdSelectorsCacheSize) {}
 
 AdBlockService::~AdBlockService() {}
 
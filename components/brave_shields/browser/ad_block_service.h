@@ -10,11 +10,13 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/optional.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
+#include "brave/components/cosmetic_filters/common/hidden_class_id_selectors_cache.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "content/public/browser/browser_thread.h"
@@ -61,6 +63,13 @@ class AdBlockService : public AdBlockBaseService {
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions) override;
+  // Returns the selectors hidden by each of |classes| and |ids|, before any
+  // exceptions, along with the filter list version they were matched
+  // against. Results are cached until that version changes.
+  std::pair<cosmetic_filters::HiddenClassIdSelectorsCache::SelectorsMap,
+            uint64_t>
+  HiddenClassIdSelectorsByName(const std::vector<std::string>& classes,
+                               const std::vector<std::string>& ids);
 
   AdBlockRegionalServiceManager* regional_service_manager();
   AdBlockCustomFiltersService* custom_filters_service();
@@ -82,6 +91,10 @@ class AdBlockService : public AdBlockBaseService {
       const std::string& component_id,
       const std::string& component_base64_public_key);
 
+  std::vector<std::string> MatchHiddenClassIdSelectors(
+      const std::vector<std::string>& classes,
+      const std::vector<std::string>& ids);
+
   std::unique_ptr<brave_shields::AdBlockRegionalServiceManager>
       regional_service_manager_;
   std::unique_ptr<brave_shields::AdBlockCustomFiltersService>
@@ -89,6 +102,10 @@ class AdBlockService : public AdBlockBaseService {
 
   BraveComponent::Delegate* component_delegate_;
 
+  // Only used on the task runner.
+  cosmetic_filters::HiddenClassIdSelectorsCache
+      hidden_class_id_selectors_cache_;
+
   base::WeakPtrFactory<AdBlockService> weak_factory_{this};
   DISALLOW_COPY_AND_ASSIGN(AdBlockService);
 };
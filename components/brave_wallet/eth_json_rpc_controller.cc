@@ -8,6 +8,10 @@
 #include <utility>
 
 #include "base/environment.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "base/values.h"
 #include "brave/components/brave_wallet/eth_call_data_builder.h"
 #include "brave/components/brave_wallet/eth_requests.h"
 #include "brave/components/brave_wallet/eth_response_parser.h"
@@ -44,6 +48,15 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// Calls made within this window of each other are sent as one batch, which
+// lets a portfolio refresh of N token balances go out as a single request.
+constexpr base::TimeDelta kBatchWindow = base::TimeDelta::FromMilliseconds(10);
+
+// Upper bound on how long results for the latest block are reused when no
+// batch has told us about a newer block yet.
+constexpr base::TimeDelta kLatestBlockCacheTTL =
+    base::TimeDelta::FromSeconds(5);
+
 std::string GetInfuraProjectID() {
   std::string project_id(BRAVE_INFURA_PROJECT_ID);
   std::unique_ptr<base::Environment> env(base::Environment::Create());
@@ -61,6 +74,11 @@ bool GetUseStagingInfuraEndpoint() {
   return env->HasVar("BRAVE_INFURA_STAGING");
 }
 
+bool HasJsonRpcResult(const std::string& body) {
+  base::Optional<base::Value> response = base::JSONReader::Read(body);
+  return response && response->is_dict() && response->FindKey("result");
+}
+
 }  // namespace
 
 namespace brave_wallet {
@@ -73,6 +91,12 @@ EthJsonRpcController::EthJsonRpcController(content::BrowserContext* context,
 
 EthJsonRpcController::~EthJsonRpcController() {}
 
+EthJsonRpcController::PendingCall::PendingCall() = default;
+EthJsonRpcController::PendingCall::PendingCall(PendingCall&&) = default;
+EthJsonRpcController::PendingCall& EthJsonRpcController::PendingCall::operator=(
+    PendingCall&&) = default;
+EthJsonRpcController::PendingCall::~PendingCall() = default;
+
 void EthJsonRpcController::Request(const std::string& json_payload,
                                    URLRequestCallback callback,
                                    bool auto_retry_on_network_change) {
@@ -95,10 +119,12 @@ void EthJsonRpcController::Request(const std::string& json_payload,
           : network::SimpleURLLoader::RetryMode::RETRY_NEVER);
   auto iter = url_loaders_.insert(url_loaders_.begin(), std::move(url_loader));
 
-  auto* default_storage_partition =
-      content::BrowserContext::GetDefaultStoragePartition(context_);
   auto* url_loader_factory =
-      default_storage_partition->GetURLLoaderFactoryForBrowserProcess().get();
+      url_loader_factory_for_testing_
+          ? url_loader_factory_for_testing_.get()
+          : content::BrowserContext::GetDefaultStoragePartition(context_)
+                ->GetURLLoaderFactoryForBrowserProcess()
+                .get();
 
   iter->get()->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
       url_loader_factory,
@@ -132,6 +158,159 @@ void EthJsonRpcController::OnURLLoaderComplete(
                           headers);
 }
 
+void EthJsonRpcController::BatchRequest(const std::string& json_payload,
+                                        URLRequestCallback callback,
+                                        bool cacheable) {
+  if (cacheable && !latest_block_number_.empty() &&
+      base::TimeTicks::Now() - latest_block_time_ < kLatestBlockCacheTTL) {
+    auto cached = latest_block_cache_.find(json_payload);
+    if (cached != latest_block_cache_.end()) {
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback), 200, cached->second,
+                                    std::map<std::string, std::string>()));
+      return;
+    }
+  }
+
+  PendingCallKey key(network_url_, json_payload);
+  auto it = pending_calls_.find(key);
+  if (it != pending_calls_.end()) {
+    it->second.callbacks.push_back(std::move(callback));
+    return;
+  }
+
+  PendingCall call;
+  call.cacheable = cacheable;
+  call.callbacks.push_back(std::move(callback));
+  pending_calls_.emplace(std::move(key), std::move(call));
+  pending_batch_.push_back(json_payload);
+  if (!batch_timer_.IsRunning()) {
+    batch_timer_.Start(FROM_HERE, kBatchWindow,
+                       base::BindOnce(&EthJsonRpcController::SendBatch,
+                                      base::Unretained(this)));
+  }
+}
+
+void EthJsonRpcController::SendBatch() {
+  std::vector<std::string> payloads;
+  payloads.swap(pending_batch_);
+  if (payloads.empty())
+    return;
+
+  // A lone call goes out unchanged so that endpoints without batch support
+  // keep working for the common single-balance case.
+  if (payloads.size() == 1) {
+    Request(payloads[0],
+            base::BindOnce(&EthJsonRpcController::RunPendingCall,
+                           weak_ptr_factory_.GetWeakPtr(), payloads[0],
+                           network_url_),
+            true);
+    return;
+  }
+
+  // Every batch also asks for the block number so that results for the
+  // latest block can be reused until the chain moves on.
+  payloads.push_back(eth_blockNumber());
+  base::Value batch(base::Value::Type::LIST);
+  for (size_t i = 0; i < payloads.size(); ++i) {
+    base::Optional<base::Value> call = base::JSONReader::Read(payloads[i]);
+    if (!call || !call->is_dict()) {
+      call = base::Value(base::Value::Type::DICTIONARY);
+    }
+    call->SetIntKey("id", static_cast<int>(i));
+    batch.Append(std::move(*call));
+  }
+  std::string json_payload;
+  base::JSONWriter::Write(batch, &json_payload);
+
+  Request(json_payload,
+          base::BindOnce(&EthJsonRpcController::OnBatchResponse,
+                         weak_ptr_factory_.GetWeakPtr(), std::move(payloads),
+                         network_url_),
+          true);
+}
+
+void EthJsonRpcController::FlushBatch() {
+  if (!batch_timer_.IsRunning())
+    return;
+  batch_timer_.Stop();
+  SendBatch();
+}
+
+void EthJsonRpcController::OnBatchResponse(
+    std::vector<std::string> payloads,
+    const GURL& network_url,
+    const int status,
+    const std::string& body,
+    const std::map<std::string, std::string>& headers) {
+  // The last entry is the block number we appended in SendBatch.
+  const size_t block_number_index = payloads.size() - 1;
+  std::vector<std::string> responses(payloads.size());
+  base::Optional<base::Value> records_v = base::JSONReader::Read(body);
+  if (status < 200 || status > 299 || !records_v || !records_v->is_list()) {
+    for (size_t i = 0; i < block_number_index; ++i)
+      RunPendingCall(payloads[i], network_url, status, body, headers);
+    return;
+  }
+
+  for (const auto& record : records_v->GetList()) {
+    if (!record.is_dict())
+      continue;
+    base::Optional<int> id = record.FindIntKey("id");
+    if (!id || *id < 0 || static_cast<size_t>(*id) >= payloads.size())
+      continue;
+    base::JSONWriter::Write(record, &responses[*id]);
+  }
+
+  std::string block_number;
+  if (network_url == network_url_ &&
+      ParseEthBlockNumber(responses[block_number_index], &block_number)) {
+    UpdateLatestBlockNumber(block_number);
+  }
+
+  for (size_t i = 0; i < block_number_index; ++i)
+    RunPendingCall(payloads[i], network_url, status, responses[i], headers);
+}
+
+void EthJsonRpcController::RunPendingCall(
+    const std::string& payload,
+    const GURL& network_url,
+    const int status,
+    const std::string& body,
+    const std::map<std::string, std::string>& headers) {
+  auto it = pending_calls_.find(PendingCallKey(network_url, payload));
+  if (it == pending_calls_.end())
+    return;
+  PendingCall call = std::move(it->second);
+  pending_calls_.erase(it);
+
+  // Only cache results that belong to the block we last saw on the network
+  // that is still selected.
+  if (call.cacheable && status >= 200 && status <= 299 &&
+      !latest_block_number_.empty() && network_url == network_url_ &&
+      HasJsonRpcResult(body)) {
+    latest_block_cache_[payload] = body;
+  }
+
+  for (auto& callback : call.callbacks)
+    std::move(callback).Run(status, body, headers);
+}
+
+void EthJsonRpcController::UpdateLatestBlockNumber(
+    const std::string& block_number) {
+  if (block_number != latest_block_number_) {
+    latest_block_cache_.clear();
+    latest_block_number_ = block_number;
+  }
+  latest_block_time_ = base::TimeTicks::Now();
+}
+
+void EthJsonRpcController::ResetLatestBlockCache() {
+  latest_block_cache_.clear();
+  latest_block_number_.clear();
+  latest_block_time_ = base::TimeTicks();
+}
+
 Network EthJsonRpcController::GetNetwork() const {
   return network_;
 }
@@ -142,7 +321,9 @@ GURL EthJsonRpcController::GetNetworkURL() const {
 
 void EthJsonRpcController::SetNetwork(Network network) {
   std::string subdomain;
+  FlushBatch();
   network_ = network;
+  ResetLatestBlockCache();
   switch (network) {
     case Network::kMainnet:
       subdomain = "mainnet";
@@ -175,8 +356,15 @@ void EthJsonRpcController::SetNetwork(Network network) {
 }
 
 void EthJsonRpcController::SetCustomNetwork(const GURL& network_url) {
+  FlushBatch();
   network_ = Network::kCustom;
   network_url_ = network_url;
+  ResetLatestBlockCache();
+}
+
+void EthJsonRpcController::SetURLLoaderFactoryForTesting(
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory) {
+  url_loader_factory_for_testing_ = std::move(url_loader_factory);
 }
 
 void EthJsonRpcController::GetBalance(
@@ -185,8 +373,8 @@ void EthJsonRpcController::GetBalance(
   auto internal_callback =
       base::BindOnce(&EthJsonRpcController::OnGetBalance,
                      base::Unretained(this), std::move(callback));
-  return Request(eth_getBalance(address, "latest"),
-                 std::move(internal_callback), true);
+  BatchRequest(eth_getBalance(address, "latest"),
+               std::move(internal_callback), true);
 }
 
 void EthJsonRpcController::OnGetBalance(
@@ -218,8 +406,8 @@ bool EthJsonRpcController::GetERC20TokenBalance(
   if (!erc20::BalanceOf(address, &data)) {
     return false;
   }
-  Request(eth_call("", address, "", "", "", data, ""),
-          std::move(internal_callback), true);
+  BatchRequest(eth_call("", contract, "", "", "", data, "latest"),
+               std::move(internal_callback), true);
   return true;
 }
 
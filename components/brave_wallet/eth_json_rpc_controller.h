@@ -10,8 +10,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/brave_wallet/brave_wallet_constants.h"
 #include "url/gurl.h"
 
@@ -20,6 +26,7 @@ class BrowserContext;
 }  // namespace content
 
 namespace network {
+class SharedURLLoaderFactory;
 class SimpleURLLoader;
 }  // namespace network
 
@@ -56,9 +63,49 @@ class EthJsonRpcController {
   static std::string GetChainIDFromNetwork(Network network);
   static GURL GetBlockTrackerURLFromNetwork(Network network);
 
+  void SetURLLoaderFactoryForTesting(
+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
+
  private:
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
+
+  struct PendingCall {
+    PendingCall();
+    PendingCall(PendingCall&&);
+    PendingCall& operator=(PendingCall&&);
+    ~PendingCall();
+    bool cacheable = false;
+    std::vector<URLRequestCallback> callbacks;
+  };
+
+  // Calls are shared per network, so a call made after a network change
+  // never gets the answer of the previously selected network.
+  using PendingCallKey = std::pair<GURL, std::string>;
+
+  // Queues |json_payload| to be sent together with the other calls made
+  // within the batch window as a single JSON-RPC batch. Identical calls to
+  // the same network that are queued or in flight share one request.
+  // |cacheable| calls are made against the latest block and are answered
+  // from |latest_block_cache_| until a new block number is seen.
+  void BatchRequest(const std::string& json_payload,
+                    URLRequestCallback callback,
+                    bool cacheable);
+  void SendBatch();
+  // Sends the calls queued for the current network before it changes.
+  void FlushBatch();
+  void OnBatchResponse(std::vector<std::string> payloads,
+                       const GURL& network_url,
+                       const int status,
+                       const std::string& body,
+                       const std::map<std::string, std::string>& headers);
+  void RunPendingCall(const std::string& payload,
+                      const GURL& network_url,
+                      const int status,
+                      const std::string& body,
+                      const std::map<std::string, std::string>& headers);
+  void UpdateLatestBlockNumber(const std::string& block_number);
+  void ResetLatestBlockCache();
   void OnURLLoaderComplete(SimpleURLLoaderList::iterator iter,
                            URLRequestCallback callback,
                            const std::unique_ptr<std::string> response_body);
@@ -76,6 +123,19 @@ class EthJsonRpcController {
   GURL network_url_;
   SimpleURLLoaderList url_loaders_;
   Network network_;
+
+  std::vector<std::string> pending_batch_;
+  std::map<PendingCallKey, PendingCall> pending_calls_;
+  base::OneShotTimer batch_timer_;
+
+  std::string latest_block_number_;
+  base::TimeTicks latest_block_time_;
+  std::map<std::string, std::string> latest_block_cache_;
+
+  scoped_refptr<network::SharedURLLoaderFactory>
+      url_loader_factory_for_testing_;
+
+  base::WeakPtrFactory<EthJsonRpcController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_wallet
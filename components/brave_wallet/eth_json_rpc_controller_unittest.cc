@@ -4,12 +4,16 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "base/test/bind.h"
 #include "brave/components/brave_wallet/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/eth_json_rpc_controller.h"
 #include "content/public/test/browser_task_environment.h"
 #include "content/public/test/test_browser_context.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 
@@ -18,16 +22,32 @@ namespace brave_wallet {
 class EthJsonRpcControllerUnitTest : public testing::Test {
  public:
   EthJsonRpcControllerUnitTest()
-      : browser_context_(new content::TestBrowserContext()) {}
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        browser_context_(new content::TestBrowserContext()),
+        shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)) {}
   ~EthJsonRpcControllerUnitTest() override = default;
 
   content::TestBrowserContext* context() { return browser_context_.get(); }
 
- private:
+ protected:
   content::BrowserTaskEnvironment task_environment_;
+  network::TestURLLoaderFactory url_loader_factory_;
   std::unique_ptr<content::TestBrowserContext> browser_context_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
 };
 
+namespace {
+
+constexpr char kAddress[] = "0x4e02f254184E904300e0775E4b8eeCB1d7C26a66";
+
+std::string BalanceResponse(const std::string& balance) {
+  return "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":\"" + balance + "\"}";
+}
+
+}  // namespace
+
 TEST_F(EthJsonRpcControllerUnitTest, SetNetwork) {
   EthJsonRpcController controller(context(), Network::kRinkeby);
   ASSERT_EQ(controller.GetNetwork(), Network::kRinkeby);
@@ -72,4 +92,75 @@ TEST_F(EthJsonRpcControllerUnitTest, SetCustomNetwork) {
   ASSERT_EQ(controller.GetNetworkURL(), custom_network);
 }
 
+TEST_F(EthJsonRpcControllerUnitTest, NetworkChangeDetachesPendingCalls) {
+  EthJsonRpcController controller(context(), Network::kMainnet);
+  controller.SetURLLoaderFactoryForTesting(shared_url_loader_factory_);
+  const GURL mainnet_url = controller.GetNetworkURL();
+
+  std::string mainnet_balance;
+  controller.GetBalance(kAddress, base::BindLambdaForTesting(
+                                      [&](bool status, const std::string& b) {
+                                        EXPECT_TRUE(status);
+                                        mainnet_balance = b;
+                                      }));
+  task_environment_.FastForwardUntilNoTasksRemain();
+  EXPECT_EQ(url_loader_factory_.NumPending(), 1);
+
+  // The same call made while the mainnet one is in flight must not share
+  // its answer once the network changed.
+  controller.SetNetwork(Network::kRopsten);
+  const GURL ropsten_url = controller.GetNetworkURL();
+  std::string ropsten_balance;
+  controller.GetBalance(kAddress, base::BindLambdaForTesting(
+                                      [&](bool status, const std::string& b) {
+                                        EXPECT_TRUE(status);
+                                        ropsten_balance = b;
+                                      }));
+  task_environment_.FastForwardUntilNoTasksRemain();
+  EXPECT_EQ(url_loader_factory_.NumPending(), 2);
+
+  url_loader_factory_.AddResponse(mainnet_url.spec(),
+                                  BalanceResponse("0xb539d5"));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(mainnet_balance, "0xb539d5");
+  EXPECT_TRUE(ropsten_balance.empty());
+
+  url_loader_factory_.AddResponse(ropsten_url.spec(), BalanceResponse("0x1"));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(ropsten_balance, "0x1");
+}
+
+TEST_F(EthJsonRpcControllerUnitTest, NetworkChangeSendsQueuedCalls) {
+  EthJsonRpcController controller(context(), Network::kMainnet);
+  controller.SetURLLoaderFactoryForTesting(shared_url_loader_factory_);
+  const GURL mainnet_url = controller.GetNetworkURL();
+
+  // Calls still waiting for the batch window go to the network they were
+  // made on.
+  std::string mainnet_balance;
+  controller.GetBalance(kAddress, base::BindLambdaForTesting(
+                                      [&](bool status, const std::string& b) {
+                                        mainnet_balance = b;
+                                      }));
+  GURL custom_network("http://test.com/");
+  controller.SetCustomNetwork(custom_network);
+  EXPECT_TRUE(url_loader_factory_.IsPending(mainnet_url.spec()));
+
+  std::string custom_balance;
+  controller.GetBalance(kAddress, base::BindLambdaForTesting(
+                                      [&](bool status, const std::string& b) {
+                                        custom_balance = b;
+                                      }));
+  task_environment_.FastForwardUntilNoTasksRemain();
+  EXPECT_TRUE(url_loader_factory_.IsPending(custom_network.spec()));
+
+  url_loader_factory_.AddResponse(custom_network.spec(),
+                                  BalanceResponse("0x2"));
+  url_loader_factory_.AddResponse(mainnet_url.spec(),
+                                  BalanceResponse("0xb539d5"));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(mainnet_balance, "0xb539d5");
+  EXPECT_EQ(custom_balance, "0x2");
+}
+
 }  // namespace brave_wallet
@@ -43,4 +43,8 @@ bool ParseEthCall(const std::string& json, std::string* result) {
   return ParseSingleStringResult(json, result);
 }
 
+bool ParseEthBlockNumber(const std::string& json, std::string* block_number) {
+  return ParseSingleStringResult(json, block_number);
+}
+
 }  // namespace brave_wallet
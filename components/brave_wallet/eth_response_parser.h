@@ -14,6 +14,8 @@ namespace brave_wallet {
 // Returns the balance of the account of given address.
 bool ParseEthGetBalance(const std::string& json, std::string* hex_balance);
 bool ParseEthCall(const std::string& json, std::string* result);
+// Returns the number of the most recent block.
+bool ParseEthBlockNumber(const std::string& json, std::string* block_number);
 
 }  // namespace brave_wallet
 
@@ -55,4 +55,16 @@ TEST(EthResponseParserUnitTest, ParseEthCall) {
   ASSERT_EQ(result, "0x0");
 }
 
+TEST(EthResponseParserUnitTest, ParseEthBlockNumber) {
+  std::string json(
+      R"({
+    "id":1,
+    "jsonrpc": "2.0",
+    "result": "0x4b7"
+  })");
+  std::string block_number;
+  ASSERT_TRUE(ParseEthBlockNumber(json, &block_number));
+  ASSERT_EQ(block_number, "0x4b7");
+}
+
 }  // namespace brave_wallet
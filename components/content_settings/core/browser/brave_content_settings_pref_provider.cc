@@ -5,7 +5,10 @@
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
+#include <algorithm>
 #include <memory>
+#include <set>
+#include <tuple>
 #include <utility>
 
 #include "base/bind.h"
@@ -89,30 +92,18 @@ class BraveShieldsRuleIterator : public RuleIterator {
 };
 
 
-bool IsActive(const Rule& cookie_rule,
-              const std::vector<Rule>& shield_rules) {
-  // don't include default rules in the iterator
-  if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
-      (cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
-       cookie_rule.secondary_pattern ==
-          ContentSettingsPattern::FromString("https://firstParty/*"))) {
-    return false;
-  }
+using CookieRuleKey =
+    std::tuple<ContentSettingsPattern, ContentSettingsPattern, ContentSetting>;
+using CookiePatternsKey =
+    std::pair<ContentSettingsPattern, ContentSettingsPattern>;
 
-  bool default_value = true;
-  for (const auto& shield_rule : shield_rules) {
-    auto primary_compare =
-        shield_rule.primary_pattern.Compare(cookie_rule.primary_pattern);
-    // TODO(bridiver) - verify that SUCCESSOR is correct and not PREDECESSOR
-    if (primary_compare == ContentSettingsPattern::IDENTITY ||
-        primary_compare == ContentSettingsPattern::SUCCESSOR) {
-      // TODO(bridiver) - move this logic into shields_util for allow/block
-      return
-          ValueToContentSetting(&shield_rule.value) != CONTENT_SETTING_BLOCK;
-    }
-  }
+CookieRuleKey GetCookieRuleKey(const Rule& rule) {
+  return std::make_tuple(rule.primary_pattern, rule.secondary_pattern,
+                         ValueToContentSetting(&rule.value));
+}
 
-  return default_value;
+CookiePatternsKey GetCookiePatternsKey(const Rule& rule) {
+  return std::make_pair(rule.primary_pattern, rule.secondary_pattern);
 }
 
 }  // namespace
@@ -438,13 +429,123 @@ std::unique_ptr<RuleIterator> BravePrefProvider::GetRuleIterator(
   return PrefProvider::GetRuleIterator(content_type, incognito);
 }
 
+void BravePrefProvider::UpdateShieldsRules(bool incognito) {
+  auto& shields_rules = shields_rules_[incognito];
+  shields_rules.clear();
+
+  auto brave_shields_iterator = PrefProvider::GetRuleIterator(
+      ContentSettingsType::BRAVE_SHIELDS, incognito);
+  while (brave_shields_iterator && brave_shields_iterator->HasNext()) {
+    auto rule = brave_shields_iterator->Next();
+    // The iterator goes from highest to lowest precedence, so keep the first
+    // rule for a primary pattern.
+    shields_rules[rule.primary_pattern.GetHost()].emplace(
+        rule.primary_pattern, ValueToContentSetting(&rule.value));
+  }
+}
+
+void BravePrefProvider::UpdateShieldsRule(
+    const ContentSettingsPattern& primary_pattern,
+    bool incognito) {
+  auto index = shields_rules_.find(incognito);
+  if (index == shields_rules_.end())
+    return;  // Built from scratch on the next cookie rules update.
+
+  // Changes that are not for a single pattern, like clearing all settings or
+  // a pref sync, are notified with empty or wildcard patterns.
+  if (!primary_pattern.IsValid() ||
+      primary_pattern == ContentSettingsPattern::Wildcard()) {
+    UpdateShieldsRules(incognito);
+    return;
+  }
+
+  const std::string& host = primary_pattern.GetHost();
+  auto& shields_rules = index->second;
+  auto host_rules = shields_rules.find(host);
+  if (host_rules != shields_rules.end()) {
+    host_rules->second.erase(primary_pattern);
+    if (host_rules->second.empty())
+      shields_rules.erase(host_rules);
+  }
+
+  auto brave_shields_iterator = PrefProvider::GetRuleIterator(
+      ContentSettingsType::BRAVE_SHIELDS, incognito);
+  while (brave_shields_iterator && brave_shields_iterator->HasNext()) {
+    auto rule = brave_shields_iterator->Next();
+    if (rule.primary_pattern == primary_pattern) {
+      shields_rules[host].emplace(primary_pattern,
+                                  ValueToContentSetting(&rule.value));
+      return;
+    }
+  }
+}
+
+bool BravePrefProvider::IsActive(const Rule& cookie_rule,
+                                 bool incognito) const {
+  // don't include default rules in the iterator
+  if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
+      (cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
+       cookie_rule.secondary_pattern ==
+          ContentSettingsPattern::FromString("https://firstParty/*"))) {
+    return false;
+  }
+
+  // A shields rule applies if its primary pattern is the same as or broader
+  // than the one of the cookie rule, so its host is the cookie rule host, one
+  // of its parent domains or the wildcard host. Of those, the shields rule
+  // with the highest precedence wins.
+  const auto& shields_rules = shields_rules_.at(incognito);
+  const ContentSettingsPattern* shields_pattern = nullptr;
+  ContentSetting shields_setting = CONTENT_SETTING_DEFAULT;
+  std::string host = cookie_rule.primary_pattern.GetHost();
+  while (true) {
+    auto host_rules = shields_rules.find(host);
+    if (host_rules != shields_rules.end()) {
+      for (const auto& shields_rule : host_rules->second) {
+        if (shields_pattern && !(shields_rule.first > *shields_pattern))
+          break;
+        auto primary_compare =
+            shields_rule.first.Compare(cookie_rule.primary_pattern);
+        // TODO(bridiver) - verify that SUCCESSOR is correct and not
+        // PREDECESSOR
+        if (primary_compare == ContentSettingsPattern::IDENTITY ||
+            primary_compare == ContentSettingsPattern::SUCCESSOR) {
+          shields_pattern = &shields_rule.first;
+          shields_setting = shields_rule.second;
+          break;
+        }
+      }
+    }
+
+    if (host.empty())
+      break;
+    size_t dot = host.find('.');
+    host = dot == std::string::npos ? std::string() : host.substr(dot + 1);
+  }
+
+  if (!shields_pattern)
+    return true;
+
+  // TODO(bridiver) - move this logic into shields_util for allow/block
+  return shields_setting != CONTENT_SETTING_BLOCK;
+}
+
 void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
                                           bool incognito) {
   auto& rules = cookie_rules_[incognito];
-  auto old_rules = std::move(brave_cookie_rules_[incognito]);
-
   rules.clear();
-  brave_cookie_rules_[incognito].clear();
+
+  // Chromium cookie changes don't affect the brave rules, so only the
+  // chromium part of |rules| needs to be rebuilt.
+  const bool update_brave_rules =
+      content_type != ContentSettingsType::COOKIES ||
+      !brave_cookie_rules_.count(incognito);
+  std::vector<Rule> old_rules;
+  if (update_brave_rules) {
+    old_rules = std::move(brave_cookie_rules_[incognito]);
+    brave_cookie_rules_[incognito].clear();
+  }
+  auto& brave_rules = brave_cookie_rules_[incognito];
 
   // kGoogleLoginControlType preference adds an exception for
   // accounts.google.com to access cookies in 3p context to allow login using
@@ -456,6 +557,7 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   // We also create the same exception for firebase apps, since they
   // are tightly bound to google, and require google auth to work.
   // See: #5075, #9852, #10367
+  size_t google_rules_count = 0;
   if (prefs_->GetBoolean(kGoogleLoginControlType)) {
     const auto google_auth_rule = Rule(
         ContentSettingsPattern::FromString(kGoogleAuthPattern),
@@ -464,7 +566,6 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
                          ContentSettingToValue(CONTENT_SETTING_ALLOW)),
                      base::Time(), SessionModel::Durable);
     rules.emplace_back(CloneRule(google_auth_rule));
-    brave_cookie_rules_[incognito].emplace_back(CloneRule(google_auth_rule));
 
     const auto firebase_rule = Rule(
         ContentSettingsPattern::FromString(kFirebasePattern),
@@ -473,7 +574,12 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
             ContentSettingToValue(CONTENT_SETTING_ALLOW)),
         base::Time(), SessionModel::Durable);
     rules.emplace_back(CloneRule(firebase_rule));
-    brave_cookie_rules_[incognito].emplace_back(CloneRule(firebase_rule));
+
+    google_rules_count = rules.size();
+    if (update_brave_rules) {
+      for (const auto& rule : rules)
+        brave_rules.emplace_back(CloneRule(rule));
+    }
   }
   // non-pref based exceptions should go in the cookie_settings_base.cc
   // chromium_src override
@@ -487,16 +593,15 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   }
   chromium_cookies_iterator.reset();
 
-  auto brave_shields_iterator = PrefProvider::GetRuleIterator(
-      ContentSettingsType::BRAVE_SHIELDS, incognito);
-
-  // collect shield rules
-  std::vector<Rule> shield_rules;
-  while (brave_shields_iterator && brave_shields_iterator->HasNext()) {
-    shield_rules.emplace_back(CloneRule(brave_shields_iterator->Next()));
+  if (!update_brave_rules) {
+    DCHECK_LE(google_rules_count, brave_rules.size());
+    for (size_t i = google_rules_count; i < brave_rules.size(); ++i)
+      rules.emplace_back(CloneRule(brave_rules[i]));
+    return;
   }
 
-  brave_shields_iterator.reset();
+  if (!shields_rules_.count(incognito))
+    UpdateShieldsRules(incognito);
 
   // add brave cookies after checking shield status
   auto brave_cookies_iterator = PrefProvider::GetRuleIterator(
@@ -505,66 +610,63 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   // Matching cookie rules against shield rules.
   while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
     auto rule = brave_cookies_iterator->Next();
-    if (IsActive(rule, shield_rules)) {
+    if (IsActive(rule, incognito)) {
       rules.emplace_back(CloneRule(rule, true));
-      brave_cookie_rules_[incognito].emplace_back(CloneRule(rule, true));
+      brave_rules.emplace_back(CloneRule(rule, true));
     }
   }
 
-  // Adding shields down rules (they always override cookie rules).
-  for (const auto& shield_rule : shield_rules) {
-    // There is no global shields rule
-    if (shield_rule.primary_pattern.MatchesAllHosts())
-      NOTREACHED();
-
-    // Shields down.
-    if (ValueToContentSetting(&shield_rule.value) == CONTENT_SETTING_BLOCK) {
-      rules.emplace_back(
-          Rule(ContentSettingsPattern::Wildcard(),
-               shield_rule.primary_pattern,
-               base::Value::FromUniquePtrValue(
-                   ContentSettingToValue(CONTENT_SETTING_ALLOW)),
-               base::Time(), SessionModel::Durable));
-      brave_cookie_rules_[incognito].emplace_back(
-          Rule(ContentSettingsPattern::Wildcard(),
-               shield_rule.primary_pattern,
-               base::Value::FromUniquePtrValue(
-                   ContentSettingToValue(CONTENT_SETTING_ALLOW)),
-               base::Time(), SessionModel::Durable));
+  // Adding shields down rules (they always override cookie rules), from
+  // highest to lowest precedence like the shields rules they come from.
+  std::vector<ContentSettingsPattern> shields_down_patterns;
+  for (const auto& host_rules : shields_rules_[incognito]) {
+    for (const auto& shields_rule : host_rules.second) {
+      // There is no global shields rule
+      if (shields_rule.first.MatchesAllHosts())
+        NOTREACHED();
+
+      // Shields down.
+      if (shields_rule.second == CONTENT_SETTING_BLOCK)
+        shields_down_patterns.push_back(shields_rule.first);
     }
   }
+  std::sort(shields_down_patterns.begin(), shields_down_patterns.end(),
+            std::greater<ContentSettingsPattern>());
+  for (const auto& shields_down_pattern : shields_down_patterns) {
+    rules.emplace_back(
+        Rule(ContentSettingsPattern::Wildcard(),
+             shields_down_pattern,
+             base::Value::FromUniquePtrValue(
+                 ContentSettingToValue(CONTENT_SETTING_ALLOW)),
+             base::Time(), SessionModel::Durable));
+    brave_rules.emplace_back(
+        Rule(ContentSettingsPattern::Wildcard(),
+             shields_down_pattern,
+             base::Value::FromUniquePtrValue(
+                 ContentSettingToValue(CONTENT_SETTING_ALLOW)),
+             base::Time(), SessionModel::Durable));
+  }
 
   // get the list of changes
+  // we want an exact match here because any change to the rule
+  // is an update
+  std::set<CookieRuleKey> old_rule_keys;
+  for (const auto& old_rule : old_rules)
+    old_rule_keys.insert(GetCookieRuleKey(old_rule));
   std::vector<Rule> brave_cookie_updates;
-  for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match = std::find_if(
-        old_rules.begin(),
-        old_rules.end(),
-        [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(&new_rule.value) ==
-                    ValueToContentSetting(&old_rule.value);
-        });
-    if (match == old_rules.end()) {
+  for (const auto& new_rule : brave_rules) {
+    if (!old_rule_keys.count(GetCookieRuleKey(new_rule)))
       brave_cookie_updates.emplace_back(CloneRule(new_rule));
-    }
   }
 
   // find any removed rules
+  // we only care about the patterns here because we're looking
+  // for deleted rules, not changed rules
+  std::set<CookiePatternsKey> new_rule_patterns;
+  for (const auto& new_rule : brave_rules)
+    new_rule_patterns.insert(GetCookiePatternsKey(new_rule));
   for (const auto& old_rule : old_rules) {
-    auto match = std::find_if(
-        brave_cookie_rules_[incognito].begin(),
-        brave_cookie_rules_[incognito].end(),
-        [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
+    if (!new_rule_patterns.count(GetCookiePatternsKey(old_rule))) {
       brave_cookie_updates.emplace_back(
           Rule(old_rule.primary_pattern, old_rule.secondary_pattern,
                base::Value(), old_rule.expiration, old_rule.session_model));
@@ -610,6 +712,10 @@ void BravePrefProvider::OnContentSettingChanged(
   if (content_type == ContentSettingsType::COOKIES ||
       content_type == ContentSettingsType::BRAVE_COOKIES ||
       content_type == ContentSettingsType::BRAVE_SHIELDS) {
+    if (content_type == ContentSettingsType::BRAVE_SHIELDS) {
+      UpdateShieldsRule(primary_pattern, true);
+      UpdateShieldsRule(primary_pattern, false);
+    }
     OnCookieSettingsChanged(content_type);
   }
 }
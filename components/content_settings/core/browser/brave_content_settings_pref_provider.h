@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_PREF_PROVIDER_H_
 #define BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_CONTENT_SETTINGS_PREF_PROVIDER_H_
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -63,6 +64,10 @@ class BravePrefProvider : public PrefProvider,
   void MigrateShieldsSettingsV1ToV2();
   void MigrateShieldsSettingsV1ToV2ForOneType(ContentSettingsType content_type);
   void UpdateCookieRules(ContentSettingsType content_type, bool incognito);
+  void UpdateShieldsRules(bool incognito);
+  void UpdateShieldsRule(const ContentSettingsPattern& primary_pattern,
+                         bool incognito);
+  bool IsActive(const Rule& cookie_rule, bool incognito) const;
   void OnCookieSettingsChanged(ContentSettingsType content_type);
   void NotifyChanges(const std::vector<Rule>& rules, bool incognito);
   bool SetWebsiteSettingInternal(
@@ -81,6 +86,16 @@ class BravePrefProvider : public PrefProvider,
   std::map<bool /* is_incognito */, std::vector<Rule>> cookie_rules_;
   std::map<bool /* is_incognito */, std::vector<Rule>> brave_cookie_rules_;
 
+  // Shields settings keyed by the host of their primary pattern and then by
+  // the pattern itself, from highest to lowest precedence. Kept up to date
+  // from the BRAVE_SHIELDS change notifications so that a cookie rule is only
+  // compared with the shields rules for its host and its parent domains.
+  using ShieldsRules = std::map<ContentSettingsPattern,
+                                ContentSetting,
+                                std::greater<ContentSettingsPattern>>;
+  using ShieldsRulesIndex = std::map<std::string /* host */, ShieldsRules>;
+  std::map<bool /* is_incognito */, ShieldsRulesIndex> shields_rules_;
+
   bool initialized_;
   bool store_last_modified_;
   base::WeakPtrFactory<BravePrefProvider> weak_factory_;
@@ -524,4 +524,137 @@ TEST_F(BravePrefProviderTest, TestShieldsSettingsMigrationFromUnknownSettings) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, CookieRulesFollowShieldsAndCookieChanges) {
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+  const GURL site("https://www.example.com");
+  const GURL other_site("https://www.other.com");
+  const GURL third_party("https://tracker.test");
+  const auto site_pattern =
+      ContentSettingsPattern::FromString("[*.]example.com");
+
+  // Block cookies on example.com through shields.
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_COOKIES,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  // A chromium cookie exception for another site keeps the shields rule.
+  provider.SetWebsiteSetting(ContentSettingsPattern::FromURL(other_site),
+                             ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::COOKIES,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, other_site, GURL(),
+                                         ContentSettingsType::COOKIES, false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields down on example.com replaces the cookie rule with an allow rule.
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields back up restores it.
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS, nullptr, {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  provider.ShutdownOnUIThread();
+}
+
+TEST_F(BravePrefProviderTest, CookieRulesFollowMostSpecificShieldsRule) {
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+  const GURL site("https://www.example.com");
+  const GURL other_subdomain("https://mail.example.com");
+  const GURL third_party("https://tracker.test");
+  const auto site_pattern =
+      ContentSettingsPattern::FromString("www.example.com");
+  const auto domain_pattern =
+      ContentSettingsPattern::FromString("[*.]example.com");
+
+  provider.SetWebsiteSetting(domain_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_COOKIES,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_COOKIES,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+
+  // Shields are up for the whole domain but down for the more specific
+  // www.example.com, which takes precedence for that host only.
+  provider.SetWebsiteSetting(domain_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_ALLOW), {});
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party,
+                                         other_subdomain,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields back up on www.example.com restores its cookie rule.
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS, nullptr, {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party,
+                                         other_subdomain,
+                                         ContentSettingsType::COOKIES, false));
+
+  provider.ShutdownOnUIThread();
+}
+
+TEST_F(BravePrefProviderTest, CookieRulesFollowParentDomainShieldsRule) {
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+  const GURL site("https://a.www.example.com");
+  const GURL third_party("https://tracker.test");
+  const auto site_pattern =
+      ContentSettingsPattern::FromString("a.www.example.com");
+  const auto domain_pattern =
+      ContentSettingsPattern::FromString("[*.]example.com");
+
+  provider.SetWebsiteSetting(site_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_COOKIES,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Shields down on the parent domain applies to the cookie rule of the
+  // subdomain.
+  provider.SetWebsiteSetting(domain_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS,
+                             ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  // Clearing all shields settings is not notified for a single pattern.
+  provider.ClearAllContentSettingsRules(ContentSettingsType::BRAVE_SHIELDS);
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, third_party, site,
+                                         ContentSettingsType::COOKIES, false));
+
+  provider.ShutdownOnUIThread();
+}
+
 }  //  namespace content_settings
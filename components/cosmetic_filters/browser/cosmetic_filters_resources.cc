@@ -7,7 +7,6 @@
 
 #include <utility>
 
-#include "base/json/json_reader.h"
 #include "base/optional.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -26,64 +25,30 @@ CosmeticFiltersResources::CosmeticFiltersResources(
 CosmeticFiltersResources::~CosmeticFiltersResources() {}
 
 void CosmeticFiltersResources::HiddenClassIdSelectors(
-    const std::string& input,
-    const std::vector<std::string>& exceptions,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
     HiddenClassIdSelectorsCallback callback) {
-  base::Optional<base::Value> input_value = base::JSONReader::Read(input);
-  if (!input_value || !input_value->is_dict()) {
-    // Nothing to work with
-    std::move(callback).Run(base::Value());
-
-    return;
-  }
-  base::DictionaryValue* input_dict;
-  if (!input_value->GetAsDictionary(&input_dict)) {
-    std::move(callback).Run(base::Value());
-
-    return;
-  }
-  std::vector<std::string> classes;
-  base::ListValue* classes_list;
-  if (input_dict->GetList("classes", &classes_list)) {
-    for (size_t i = 0; i < classes_list->GetSize(); i++) {
-      if (!classes_list->GetList()[i].is_string()) {
-        continue;
-      }
-      classes.push_back(classes_list->GetList()[i].GetString());
-    }
-  }
-  std::vector<std::string> ids;
-  base::ListValue* ids_list;
-  if (input_dict->GetList("ids", &ids_list)) {
-    for (size_t i = 0; i < ids_list->GetSize(); i++) {
-      if (!ids_list->GetList()[i].is_string()) {
-        continue;
-      }
-      ids.push_back(ids_list->GetList()[i].GetString());
-    }
-  }
-
   ad_block_service_->GetTaskRunner()->PostTaskAndReplyWithResult(
       FROM_HERE,
-      base::BindOnce(&brave_shields::AdBlockService::HiddenClassIdSelectors,
-                     base::Unretained(ad_block_service_), classes, ids,
-                     exceptions),
+      base::BindOnce(
+          &brave_shields::AdBlockService::HiddenClassIdSelectorsByName,
+          base::Unretained(ad_block_service_), classes, ids),
       base::BindOnce(&CosmeticFiltersResources::HiddenClassIdSelectorsOnUI,
                      weak_factory_.GetWeakPtr(), std::move(callback)));
 }
 
 void CosmeticFiltersResources::HiddenClassIdSelectorsOnUI(
     HiddenClassIdSelectorsCallback callback,
-    base::Optional<base::Value> resources) {
-  std::move(callback).Run(resources ? std::move(resources.value())
-                                    : base::Value());
+    std::pair<HiddenClassIdSelectorsCache::SelectorsMap, uint64_t> selectors) {
+  std::move(callback).Run(std::move(selectors.first), selectors.second);
 }
 
 void CosmeticFiltersResources::UrlCosmeticResourcesOnUI(
     UrlCosmeticResourcesCallback callback,
     base::Optional<base::Value> resources) {
-  std::move(callback).Run(resources ? std::move(resources.value())
-                                    : base::Value());
+  std::move(callback).Run(
+      resources ? std::move(resources.value()) : base::Value(),
+      brave_shields::AdBlockBaseService::GetFilterListVersion());
 }
 
 void CosmeticFiltersResources::ShouldDoCosmeticFiltering(
@@ -8,12 +8,14 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
 #include "base/optional.h"
 #include "base/values.h"
 #include "brave/components/cosmetic_filters/common/cosmetic_filters.mojom.h"
+#include "brave/components/cosmetic_filters/common/hidden_class_id_selectors_cache.h"
 
 class HostContentSettingsMap;
 
@@ -42,9 +44,9 @@ class CosmeticFiltersResources final
       ShouldDoCosmeticFilteringCallback callback) override;
 
   // Sends back to renderer a response about rules that has to be applied
-  // for the specified selectors.
-  void HiddenClassIdSelectors(const std::string& input,
-                              const std::vector<std::string>& exceptions,
+  // for the specified class and id names.
+  void HiddenClassIdSelectors(const std::vector<std::string>& classes,
+                              const std::vector<std::string>& ids,
                               HiddenClassIdSelectorsCallback callback) override;
 
   // Sends back to renderer a response what rules and scripts has to be
@@ -53,8 +55,10 @@ class CosmeticFiltersResources final
                             UrlCosmeticResourcesCallback callback) override;
 
  private:
-  void HiddenClassIdSelectorsOnUI(HiddenClassIdSelectorsCallback callback,
-                                  base::Optional<base::Value> resources);
+  void HiddenClassIdSelectorsOnUI(
+      HiddenClassIdSelectorsCallback callback,
+      std::pair<HiddenClassIdSelectorsCache::SelectorsMap, uint64_t>
+          selectors);
 
   void UrlCosmeticResourcesOnUI(UrlCosmeticResourcesCallback callback,
                                 base::Optional<base::Value> resources);
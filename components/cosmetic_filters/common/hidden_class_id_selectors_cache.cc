@@ -0,0 +1,116 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/cosmetic_filters/common/hidden_class_id_selectors_cache.h"
+
+#include <utility>
+
+#include "base/containers/flat_set.h"
+#include "base/strings/string_util.h"
+
+namespace cosmetic_filters {
+
+namespace {
+
+// Escaped identifiers are not recognized; selectors using them make
+// GroupSelectors() fail rather than be attributed to the wrong name.
+bool IsNameChar(char c) {
+  return base::IsAsciiAlpha(c) || base::IsAsciiDigit(c) || c == '-' ||
+         c == '_' || !base::IsAscii(c);
+}
+
+}  // namespace
+
+HiddenClassIdSelectorsCache::HiddenClassIdSelectorsCache(size_t max_entries)
+    : entries_(max_entries) {}
+
+HiddenClassIdSelectorsCache::~HiddenClassIdSelectorsCache() = default;
+
+// static
+std::string HiddenClassIdSelectorsCache::ClassKey(const std::string& name) {
+  return "." + name;
+}
+
+// static
+std::string HiddenClassIdSelectorsCache::IdKey(const std::string& name) {
+  return "#" + name;
+}
+
+// static
+bool HiddenClassIdSelectorsCache::GroupSelectors(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    const std::vector<std::string>& selectors,
+    SelectorsMap* grouped_selectors) {
+  base::flat_set<std::string> keys;
+  for (const auto& name : classes)
+    keys.insert(ClassKey(name));
+  for (const auto& name : ids)
+    keys.insert(IdKey(name));
+
+  SelectorsMap grouped;
+  for (const auto& selector : selectors) {
+    if (selector.empty() || (selector[0] != '.' && selector[0] != '#'))
+      return false;
+    size_t end = 1;
+    while (end < selector.size() && IsNameChar(selector[end]))
+      end++;
+    std::string key = selector.substr(0, end);
+    if (!keys.contains(key))
+      return false;
+    grouped[key].push_back(selector);
+  }
+
+  *grouped_selectors = std::move(grouped);
+  return true;
+}
+
+void HiddenClassIdSelectorsCache::SetVersion(uint64_t version) {
+  if (version <= version_)
+    return;
+  entries_.Clear();
+  version_ = version;
+}
+
+void HiddenClassIdSelectorsCache::Lookup(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    SelectorsMap* selectors,
+    std::vector<std::string>* missing_classes,
+    std::vector<std::string>* missing_ids) {
+  auto lookup = [&](const std::string& key, const std::string& name,
+                    std::vector<std::string>* missing) {
+    auto it = entries_.Get(key);
+    if (it == entries_.end()) {
+      missing->push_back(name);
+      return;
+    }
+    if (!it->second.empty())
+      (*selectors)[key] = it->second;
+  };
+
+  for (const auto& name : classes)
+    lookup(ClassKey(name), name, missing_classes);
+  for (const auto& name : ids)
+    lookup(IdKey(name), name, missing_ids);
+}
+
+void HiddenClassIdSelectorsCache::Put(const std::vector<std::string>& classes,
+                                      const std::vector<std::string>& ids,
+                                      const SelectorsMap& selectors) {
+  for (const auto& name : classes)
+    PutKey(ClassKey(name), selectors);
+  for (const auto& name : ids)
+    PutKey(IdKey(name), selectors);
+}
+
+void HiddenClassIdSelectorsCache::PutKey(const std::string& key,
+                                         const SelectorsMap& selectors) {
+  auto it = selectors.find(key);
+  entries_.Put(key, it == selectors.end() ? std::vector<std::string>()
+                                          : it->second);
+}
+
+}  // namespace cosmetic_filters
@@ -0,0 +1,74 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_COSMETIC_FILTERS_COMMON_HIDDEN_CLASS_ID_SELECTORS_CACHE_H_
+#define BRAVE_COMPONENTS_COSMETIC_FILTERS_COMMON_HIDDEN_CLASS_ID_SELECTORS_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/mru_cache.h"
+
+namespace cosmetic_filters {
+
+// Remembers which selectors each class and id name hides, including the names
+// that hide nothing, so that names seen again do not have to be matched
+// against the ad-block engines. Names are keyed as ".class" and "#id".
+//
+// Entries are only valid for the filter list version they were computed for;
+// moving to a newer version drops them all. Versions only ever increase, so
+// older ones are ignored.
+class HiddenClassIdSelectorsCache {
+ public:
+  using SelectorsMap = base::flat_map<std::string, std::vector<std::string>>;
+
+  explicit HiddenClassIdSelectorsCache(size_t max_entries);
+  HiddenClassIdSelectorsCache(const HiddenClassIdSelectorsCache&) = delete;
+  HiddenClassIdSelectorsCache& operator=(const HiddenClassIdSelectorsCache&) =
+      delete;
+  ~HiddenClassIdSelectorsCache();
+
+  static std::string ClassKey(const std::string& name);
+  static std::string IdKey(const std::string& name);
+
+  // Splits the selectors returned for |classes| and |ids| by the name they
+  // start with. Returns false if a selector does not start with one of the
+  // requested names, in which case the names have to be matched one by one.
+  static bool GroupSelectors(const std::vector<std::string>& classes,
+                             const std::vector<std::string>& ids,
+                             const std::vector<std::string>& selectors,
+                             SelectorsMap* grouped_selectors);
+
+  void SetVersion(uint64_t version);
+  uint64_t version() const { return version_; }
+
+  // Adds the cached non-empty selector lists for |classes| and |ids| to
+  // |selectors| and returns the names that are not cached in
+  // |missing_classes| and |missing_ids|.
+  void Lookup(const std::vector<std::string>& classes,
+              const std::vector<std::string>& ids,
+              SelectorsMap* selectors,
+              std::vector<std::string>* missing_classes,
+              std::vector<std::string>* missing_ids);
+
+  // Caches the selectors matched for |classes| and |ids|. Names missing from
+  // |selectors| are cached as hiding nothing.
+  void Put(const std::vector<std::string>& classes,
+           const std::vector<std::string>& ids,
+           const SelectorsMap& selectors);
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  void PutKey(const std::string& key, const SelectorsMap& selectors);
+
+  base::MRUCache<std::string, std::vector<std::string>> entries_;
+  uint64_t version_ = 0;
+};
+
+}  // namespace cosmetic_filters
+
+#endif  // BRAVE_COMPONENTS_COSMETIC_FILTERS_COMMON_HIDDEN_CLASS_ID_SELECTORS_CACHE_H_
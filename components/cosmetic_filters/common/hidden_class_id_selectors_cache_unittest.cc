@@ -0,0 +1,86 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/cosmetic_filters/common/hidden_class_id_selectors_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=HiddenClassIdSelectorsCacheTest.*
+
+using cosmetic_filters::HiddenClassIdSelectorsCache;
+
+using Strings = std::vector<std::string>;
+
+TEST(HiddenClassIdSelectorsCacheTest, GroupsSelectorsByFirstName) {
+  HiddenClassIdSelectorsCache::SelectorsMap grouped;
+  EXPECT_TRUE(HiddenClassIdSelectorsCache::GroupSelectors(
+      {"ad", "ad-box"}, {"banner"},
+      {".ad", ".ad-box > div", ".ad.wide", "#banner", "#banner a"}, &grouped));
+
+  EXPECT_EQ(3u, grouped.size());
+  EXPECT_EQ(Strings({".ad", ".ad.wide"}), grouped[".ad"]);
+  EXPECT_EQ(Strings({".ad-box > div"}), grouped[".ad-box"]);
+  EXPECT_EQ(Strings({"#banner", "#banner a"}), grouped["#banner"]);
+}
+
+TEST(HiddenClassIdSelectorsCacheTest, FailsToGroupUnknownSelectors) {
+  HiddenClassIdSelectorsCache::SelectorsMap grouped;
+  EXPECT_FALSE(HiddenClassIdSelectorsCache::GroupSelectors(
+      {"ad"}, {}, {".ad", "div.ad"}, &grouped));
+  EXPECT_FALSE(HiddenClassIdSelectorsCache::GroupSelectors(
+      {"ad"}, {}, {".ad", "#ad"}, &grouped));
+  EXPECT_FALSE(HiddenClassIdSelectorsCache::GroupSelectors(
+      {"a:b"}, {}, {".a\\:b"}, &grouped));
+  EXPECT_TRUE(grouped.empty());
+}
+
+TEST(HiddenClassIdSelectorsCacheTest, CachesNamesThatHideNothing) {
+  HiddenClassIdSelectorsCache cache(10);
+  cache.SetVersion(1);
+  cache.Put({"ad", "header"}, {"main"}, {{".ad", {".ad"}}});
+
+  HiddenClassIdSelectorsCache::SelectorsMap selectors;
+  Strings missing_classes;
+  Strings missing_ids;
+  cache.Lookup({"ad", "header", "footer"}, {"main", "sidebar"}, &selectors,
+               &missing_classes, &missing_ids);
+
+  EXPECT_EQ(1u, selectors.size());
+  EXPECT_EQ(Strings({".ad"}), selectors[".ad"]);
+  EXPECT_EQ(Strings({"footer"}), missing_classes);
+  EXPECT_EQ(Strings({"sidebar"}), missing_ids);
+}
+
+TEST(HiddenClassIdSelectorsCacheTest, DropsEntriesForNewerVersions) {
+  HiddenClassIdSelectorsCache cache(10);
+  cache.SetVersion(2);
+  cache.Put({"ad"}, {}, {{".ad", {".ad"}}});
+
+  cache.SetVersion(1);
+  EXPECT_EQ(2u, cache.version());
+  EXPECT_EQ(1u, cache.size());
+
+  cache.SetVersion(3);
+  EXPECT_EQ(3u, cache.version());
+  EXPECT_EQ(0u, cache.size());
+}
+
+TEST(HiddenClassIdSelectorsCacheTest, EvictsLeastRecentlyUsedNames) {
+  HiddenClassIdSelectorsCache cache(2);
+  cache.Put({"a", "b"}, {}, {});
+
+  HiddenClassIdSelectorsCache::SelectorsMap selectors;
+  Strings missing_classes;
+  Strings missing_ids;
+  cache.Lookup({"a"}, {}, &selectors, &missing_classes, &missing_ids);
+  cache.Put({"c"}, {}, {});
+  cache.Lookup({"a", "b", "c"}, {}, &selectors, &missing_classes,
+               &missing_ids);
+
+  EXPECT_EQ(Strings({"b"}), missing_classes);
+}
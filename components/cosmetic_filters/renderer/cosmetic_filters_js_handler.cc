@@ -5,9 +5,13 @@
 
 #include "brave/components/cosmetic_filters/renderer/cosmetic_filters_js_handler.h"
 
+#include <utility>
+
 #include "base/bind.h"
+#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/no_destructor.h"
+#include "base/stl_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/cosmetic_filters/resources/grit/cosmetic_filters_generated_map.h"
@@ -16,6 +20,7 @@
 #include "gin/function_template.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "third_party/blink/public/common/browser_interface_broker_proxy.h"
+#include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/public/web/web_script_source.h"
@@ -29,6 +34,9 @@ static base::NoDestructor<std::string> g_observing_script("");
 static base::NoDestructor<std::vector<std::string>> g_vetted_search_engines(
     {"duckduckgo", "qwant", "bing", "startpage", "google", "yandex", "ecosia"});
 
+// Class and id names seen by all frames of this renderer process.
+const size_t kHiddenClassIdSelectorsCacheSize = 5000;
+
 const char kScriptletInitScript[] =
     R"((function() {
           let text = `%s`;
@@ -179,6 +187,26 @@ bool IsVettedSearchEngine(const GURL& url) {
   return false;
 }
 
+cosmetic_filters::HiddenClassIdSelectorsCache*
+GetHiddenClassIdSelectorsCache() {
+  static base::NoDestructor<cosmetic_filters::HiddenClassIdSelectorsCache>
+      cache(kHiddenClassIdSelectorsCacheSize);
+  return cache.get();
+}
+
+std::vector<std::string> GetStringList(const base::Value& dict,
+                                       const char* key) {
+  std::vector<std::string> strings;
+  const base::Value* list = dict.FindListKey(key);
+  if (!list)
+    return strings;
+  for (const auto& item : list->GetList()) {
+    if (item.is_string())
+      strings.push_back(item.GetString());
+  }
+  return strings;
+}
+
 }  // namespace
 
 namespace cosmetic_filters {
@@ -199,13 +227,39 @@ CosmeticFiltersJSHandler::~CosmeticFiltersJSHandler() = default;
 
 void CosmeticFiltersJSHandler::HiddenClassIdSelectors(
     const std::string& input) {
+  base::Optional<base::Value> input_value = base::JSONReader::Read(input);
+  if (!input_value || !input_value->is_dict())
+    return;
+  std::vector<std::string> classes = GetStringList(*input_value, "classes");
+  std::vector<std::string> ids = GetStringList(*input_value, "ids");
+
+  // The same names show up on most pages and in every mutation batch, so
+  // only the ones this process has not seen yet are sent to the browser.
+  HiddenClassIdSelectorsCache::SelectorsMap cached_selectors;
+  std::vector<std::string> missing_classes;
+  std::vector<std::string> missing_ids;
+  GetHiddenClassIdSelectorsCache()->Lookup(classes, ids, &cached_selectors,
+                                           &missing_classes, &missing_ids);
+  if (missing_classes.empty() && missing_ids.empty()) {
+    // Still answer asynchronously, rather than running scripts from inside
+    // the call made by the observing script.
+    render_frame_->GetTaskRunner(blink::TaskType::kInternalDefault)
+        ->PostTask(
+            FROM_HERE,
+            base::BindOnce(
+                &CosmeticFiltersJSHandler::InjectHiddenClassIdSelectors,
+                weak_ptr_factory_.GetWeakPtr(), std::move(cached_selectors)));
+    return;
+  }
+
   if (!EnsureConnected())
     return;
 
   cosmetic_filters_resources_->HiddenClassIdSelectors(
-      input, exceptions_,
+      missing_classes, missing_ids,
       base::BindOnce(&CosmeticFiltersJSHandler::OnHiddenClassIdSelectors,
-                     base::Unretained(this)));
+                     base::Unretained(this), missing_classes, missing_ids,
+                     std::move(cached_selectors)));
 }
 
 void CosmeticFiltersJSHandler::AddJavaScriptObjectToFrame(
@@ -297,7 +351,12 @@ void CosmeticFiltersJSHandler::OnShouldDoCosmeticFiltering(
                      base::Unretained(this)));
 }
 
-void CosmeticFiltersJSHandler::OnUrlCosmeticResources(base::Value result) {
+void CosmeticFiltersJSHandler::OnUrlCosmeticResources(
+    base::Value result,
+    uint64_t filter_list_version) {
+  // Drops selectors cached for older lists before the page starts asking.
+  GetHiddenClassIdSelectorsCache()->SetVersion(filter_list_version);
+
   base::DictionaryValue* resources_dict;
   blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
   if (!result.GetAsDictionary(&resources_dict) || web_frame->IsProvisional())
@@ -404,29 +463,49 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
   }
 }
 
-void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(base::Value result) {
+void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    HiddenClassIdSelectorsCache::SelectorsMap cached_selectors,
+    const HiddenClassIdSelectorsCache::SelectorsMap& selectors,
+    uint64_t filter_list_version) {
+  HiddenClassIdSelectorsCache* cache = GetHiddenClassIdSelectorsCache();
+  cache->SetVersion(filter_list_version);
+  // Replies matched against older lists are used but not cached.
+  if (cache->version() == filter_list_version)
+    cache->Put(classes, ids, selectors);
+
+  for (const auto& entry : selectors)
+    cached_selectors[entry.first] = entry.second;
+  InjectHiddenClassIdSelectors(cached_selectors);
+}
+
+void CosmeticFiltersJSHandler::InjectHiddenClassIdSelectors(
+    const HiddenClassIdSelectorsCache::SelectorsMap& selectors) {
   // If its a vetted engine AND we're not in aggressive
   // mode, don't do cosmetic filtering.
   if (!enabled_1st_party_cf_ && IsVettedSearchEngine(url_))
     return;
 
-  // We expect a List value from adblock service. That is
-  // an extra check to be sure that adblock file exist and gives us
-  // rules that we expect
-  base::ListValue* selectors_list;
-  if (!result.GetAsList(&selectors_list))
-    return;
+  // Selectors are cached before the exceptions of this page are applied.
+  base::ListValue selectors_list;
+  for (const auto& entry : selectors) {
+    for (const auto& selector : entry.second) {
+      if (!base::Contains(exceptions_, selector))
+        selectors_list.AppendString(selector);
+    }
+  }
 
   blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
   std::string json_selectors;
-  if (!base::JSONWriter::Write(*selectors_list, &json_selectors) ||
+  if (!base::JSONWriter::Write(selectors_list, &json_selectors) ||
       json_selectors.empty()) {
     json_selectors = "[]";
   }
   // Building a script for stylesheet modifications
   std::string new_selectors_script =
       base::StringPrintf(kHideSelectorsInjectScript, json_selectors.c_str());
-  if (selectors_list->GetSize() != 0) {
+  if (selectors_list.GetSize() != 0) {
     web_frame->ExecuteScriptInIsolatedWorld(
         isolated_world_id_, blink::WebString::FromUTF8(new_selectors_script));
   }
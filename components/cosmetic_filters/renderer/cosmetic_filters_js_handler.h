@@ -9,7 +9,9 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "brave/components/cosmetic_filters/common/cosmetic_filters.mojom.h"
+#include "brave/components/cosmetic_filters/common/hidden_class_id_selectors_cache.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "mojo/public/cpp/bindings/remote.h"
@@ -51,9 +53,16 @@ class CosmeticFiltersJSHandler {
   void HiddenClassIdSelectors(const std::string& input);
 
   void OnShouldDoCosmeticFiltering(bool enabled, bool first_party_enabled);
-  void OnUrlCosmeticResources(base::Value result);
+  void OnUrlCosmeticResources(base::Value result, uint64_t filter_list_version);
   void CSSRulesRoutine(base::DictionaryValue* resources_dict);
-  void OnHiddenClassIdSelectors(base::Value result);
+  void OnHiddenClassIdSelectors(
+      const std::vector<std::string>& classes,
+      const std::vector<std::string>& ids,
+      HiddenClassIdSelectorsCache::SelectorsMap cached_selectors,
+      const HiddenClassIdSelectorsCache::SelectorsMap& selectors,
+      uint64_t filter_list_version);
+  void InjectHiddenClassIdSelectors(
+      const HiddenClassIdSelectorsCache::SelectorsMap& selectors);
 
   content::RenderFrame* render_frame_;
   mojo::Remote<cosmetic_filters::mojom::CosmeticFiltersResources>
@@ -62,6 +71,7 @@ class CosmeticFiltersJSHandler {
   bool enabled_1st_party_cf_;
   std::vector<std::string> exceptions_;
   GURL url_;
+  base::WeakPtrFactory<CosmeticFiltersJSHandler> weak_ptr_factory_{this};
 };
 
 // static
@@ -34,6 +34,15 @@ const char root_host[] = "crypto.com";
 const char api_host[] = "api.crypto.com";
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// How long responses are served from memory, and for how much longer they
+// are served while being refreshed.
+constexpr base::TimeDelta kTickerInfoTTL = base::TimeDelta::FromMinutes(1);
+constexpr base::TimeDelta kChartDataTTL = base::TimeDelta::FromMinutes(5);
+constexpr base::TimeDelta kSupportedPairsTTL = base::TimeDelta::FromHours(1);
+constexpr base::TimeDelta kAssetRankingsTTL = base::TimeDelta::FromMinutes(5);
+constexpr base::TimeDelta kMaxStale = base::TimeDelta::FromMinutes(10);
+const size_t kMaxCachedAssets = 64;
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("crypto_dot_com_service", R"(
       semantics {
@@ -72,6 +81,10 @@ CryptoDotComService::CryptoDotComService(content::BrowserContext* context)
       url_loader_factory_(
           content::BrowserContext::GetDefaultStoragePartition(context_)
               ->GetURLLoaderFactoryForBrowserProcess()),
+      ticker_info_cache_(kTickerInfoTTL, kMaxStale, kMaxCachedAssets),
+      chart_data_cache_(kChartDataTTL, kMaxStale, kMaxCachedAssets),
+      supported_pairs_cache_(kSupportedPairsTTL, kMaxStale, 1),
+      asset_rankings_cache_(kAssetRankingsTTL, kMaxStale, 1),
       weak_factory_(this) {
 }
 
@@ -80,6 +93,16 @@ CryptoDotComService::~CryptoDotComService() {
 
 bool CryptoDotComService::GetTickerInfo(const std::string& asset,
                                         GetTickerInfoCallback callback) {
+  return ticker_info_cache_.Get(
+      asset,
+      base::BindOnce(&CryptoDotComService::FetchTickerInfo,
+                     base::Unretained(this), asset),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool CryptoDotComService::FetchTickerInfo(
+    const std::string& asset,
+    TickerInfoCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(&CryptoDotComService::OnTickerInfo,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(api_host, get_ticker_info_path);
@@ -89,19 +112,30 @@ bool CryptoDotComService::GetTickerInfo(const std::string& asset,
 }
 
 void CryptoDotComService::OnTickerInfo(
-  GetTickerInfoCallback callback,
+  TickerInfoCache::FetchCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   CryptoDotComTickerInfo info;
+  bool success = false;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
-    CryptoDotComJSONParser::GetTickerInfoFromJSON(json_body, &info);
+    success = CryptoDotComJSONParser::GetTickerInfoFromJSON(json_body, &info);
   }
-  std::move(callback).Run(info);
+  std::move(callback).Run(info, success);
 }
 
 bool CryptoDotComService::GetChartData(const std::string& asset,
                                        GetChartDataCallback callback) {
+  return chart_data_cache_.Get(
+      asset,
+      base::BindOnce(&CryptoDotComService::FetchChartData,
+                     base::Unretained(this), asset),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool CryptoDotComService::FetchChartData(
+    const std::string& asset,
+    ChartDataCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(&CryptoDotComService::OnChartData,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(api_host, get_chart_data_path);
@@ -113,19 +147,29 @@ bool CryptoDotComService::GetChartData(const std::string& asset,
 }
 
 void CryptoDotComService::OnChartData(
-  GetChartDataCallback callback,
+  ChartDataCache::FetchCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   CryptoDotComChartData data;
+  bool success = false;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
-    CryptoDotComJSONParser::GetChartDataFromJSON(json_body, &data);
+    success = CryptoDotComJSONParser::GetChartDataFromJSON(json_body, &data);
   }
-  std::move(callback).Run(data);
+  std::move(callback).Run(data, success);
 }
 
 bool CryptoDotComService::GetSupportedPairs(
     GetSupportedPairsCallback callback) {
+  return supported_pairs_cache_.Get(
+      get_pairs_path,
+      base::BindOnce(&CryptoDotComService::FetchSupportedPairs,
+                     base::Unretained(this)),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool CryptoDotComService::FetchSupportedPairs(
+    SupportedPairsCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(
       &CryptoDotComService::OnSupportedPairs,
       base::Unretained(this), std::move(callback));
@@ -135,19 +179,29 @@ bool CryptoDotComService::GetSupportedPairs(
 }
 
 void CryptoDotComService::OnSupportedPairs(
-  GetSupportedPairsCallback callback,
+  SupportedPairsCache::FetchCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   CryptoDotComSupportedPairs pairs;
+  bool success = false;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
-    CryptoDotComJSONParser::GetPairsFromJSON(json_body, &pairs);
+    success = CryptoDotComJSONParser::GetPairsFromJSON(json_body, &pairs);
   }
-  std::move(callback).Run(pairs);
+  std::move(callback).Run(pairs, success);
 }
 
 bool CryptoDotComService::GetAssetRankings(
     GetAssetRankingsCallback callback) {
+  return asset_rankings_cache_.Get(
+      get_gainers_losers_path,
+      base::BindOnce(&CryptoDotComService::FetchAssetRankings,
+                     base::Unretained(this)),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool CryptoDotComService::FetchAssetRankings(
+    AssetRankingsCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(
       &CryptoDotComService::OnAssetRankings,
       base::Unretained(this), std::move(callback));
@@ -157,15 +211,16 @@ bool CryptoDotComService::GetAssetRankings(
 }
 
 void CryptoDotComService::OnAssetRankings(
-    GetAssetRankingsCallback callback,
+    AssetRankingsCache::FetchCallback callback,
     const int status, const std::string& body,
     const std::map<std::string, std::string>& headers) {
   CryptoDotComAssetRankings rankings;
+  bool success = false;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
-    CryptoDotComJSONParser::GetRankingsFromJSON(json_body, &rankings);
+    success = CryptoDotComJSONParser::GetRankingsFromJSON(json_body, &rankings);
   }
-  std::move(callback).Run(rankings);
+  std::move(callback).Run(rankings, success);
 }
 
 bool CryptoDotComService::NetworkRequest(const GURL &url,
@@ -19,6 +19,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_observer.h"
+#include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_cache.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -80,16 +81,29 @@ class CryptoDotComService : public KeyedService {
 
   base::SequencedTaskRunner* io_task_runner();
 
-  void OnTickerInfo(GetTickerInfoCallback callback,
+  using TickerInfoCache = ntp_widget_utils::DataCache<CryptoDotComTickerInfo>;
+  using ChartDataCache = ntp_widget_utils::DataCache<CryptoDotComChartData>;
+  using SupportedPairsCache =
+      ntp_widget_utils::DataCache<CryptoDotComSupportedPairs>;
+  using AssetRankingsCache =
+      ntp_widget_utils::DataCache<CryptoDotComAssetRankings>;
+
+  bool FetchTickerInfo(const std::string& asset,
+                       TickerInfoCache::FetchCallback callback);
+  void OnTickerInfo(TickerInfoCache::FetchCallback callback,
                     const int status, const std::string& body,
                     const std::map<std::string, std::string>& headers);
-  void OnChartData(GetChartDataCallback callback,
+  bool FetchChartData(const std::string& asset,
+                      ChartDataCache::FetchCallback callback);
+  void OnChartData(ChartDataCache::FetchCallback callback,
                    const int status, const std::string& body,
                    const std::map<std::string, std::string>& headers);
-  void OnSupportedPairs(GetSupportedPairsCallback callback,
+  bool FetchSupportedPairs(SupportedPairsCache::FetchCallback callback);
+  void OnSupportedPairs(SupportedPairsCache::FetchCallback callback,
                         const int status, const std::string& body,
                         const std::map<std::string, std::string>& headers);
-  void OnAssetRankings(GetAssetRankingsCallback callback,
+  bool FetchAssetRankings(AssetRankingsCache::FetchCallback callback);
+  void OnAssetRankings(AssetRankingsCache::FetchCallback callback,
                        const int status, const std::string& body,
                        const std::map<std::string, std::string>& headers);
 
@@ -105,6 +119,11 @@ class CryptoDotComService : public KeyedService {
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+  // Shared by every new tab page showing the widget.
+  TickerInfoCache ticker_info_cache_;
+  ChartDataCache chart_data_cache_;
+  SupportedPairsCache supported_pairs_cache_;
+  AssetRankingsCache asset_rankings_cache_;
   base::WeakPtrFactory<CryptoDotComService> weak_factory_;
 
   friend class CryptoDotComAPIBrowserTest;
@@ -42,6 +42,13 @@ namespace {
   const char oauth_url[] = "https://exchange.gemini.com/auth";
   const unsigned int kRetriesCountOnNetworkChange = 1;
 
+  // How long prices are served from memory, and for how much longer they
+  // are served while being refreshed.
+  constexpr base::TimeDelta kTickerPriceTTL = base::TimeDelta::FromMinutes(1);
+  constexpr base::TimeDelta kTickerPriceMaxStale =
+      base::TimeDelta::FromMinutes(10);
+  const size_t kMaxCachedTickerPrices = 64;
+
   net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     return net::DefineNetworkTrafficAnnotation("gemini_service", R"(
         semantics {
@@ -141,6 +148,9 @@ GeminiService::GeminiService(content::BrowserContext* context)
       url_loader_factory_(
           content::BrowserContext::GetDefaultStoragePartition(context_)
               ->GetURLLoaderFactoryForBrowserProcess()),
+      ticker_price_cache_(kTickerPriceTTL,
+                          kTickerPriceMaxStale,
+                          kMaxCachedTickerPrices),
       weak_factory_(this) {
   LoadTokensFromPrefs();
 }
@@ -220,6 +230,15 @@ void GeminiService::OnGetAccessToken(
 
 bool GeminiService::GetTickerPrice(const std::string& asset,
                                    GetTickerPriceCallback callback) {
+  return ticker_price_cache_.Get(
+      asset,
+      base::BindOnce(&GeminiService::FetchTickerPrice, base::Unretained(this),
+                     asset),
+      ntp_widget_utils::IgnoreSuccess(std::move(callback)));
+}
+
+bool GeminiService::FetchTickerPrice(const std::string& asset,
+                                     TickerPriceCache::FetchCallback callback) {
   auto internal_callback = base::BindOnce(&GeminiService::OnTickerPrice,
       base::Unretained(this), std::move(callback));
   GURL url = GetURLWithPath(api_host_,
@@ -229,14 +248,15 @@ bool GeminiService::GetTickerPrice(const std::string& asset,
 }
 
 void GeminiService::OnTickerPrice(
-  GetTickerPriceCallback callback,
+  TickerPriceCache::FetchCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   std::string price;
+  bool success = false;
   if (status >= 200 && status <= 299) {
-    GeminiJSONParser::GetTickerPriceFromJSON(body, &price);
+    success = GeminiJSONParser::GetTickerPriceFromJSON(body, &price);
   }
-  std::move(callback).Run(price);
+  std::move(callback).Run(price, success);
 }
 
 bool GeminiService::GetAccountBalances(GetAccountBalancesCallback callback) {
@@ -19,6 +19,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_observer.h"
+#include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_cache.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -104,6 +105,8 @@ class GeminiService : public KeyedService {
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
 
+  using TickerPriceCache = ntp_widget_utils::DataCache<std::string>;
+
   bool LoadTokensFromPrefs();
   bool SetAccessTokens(const std::string& access_token,
                        const std::string& refresh_token);
@@ -112,7 +115,9 @@ class GeminiService : public KeyedService {
   void OnGetAccessToken(AccessTokenCallback callback,
                         const int status, const std::string& body,
                         const std::map<std::string, std::string>& headers);
-  void OnTickerPrice(GetTickerPriceCallback callback,
+  bool FetchTickerPrice(const std::string& asset,
+                        TickerPriceCache::FetchCallback callback);
+  void OnTickerPrice(TickerPriceCache::FetchCallback callback,
                      const int status, const std::string& body,
                      const std::map<std::string, std::string>& headers);
   void OnGetAccountBalances(GetAccountBalancesCallback callback,
@@ -156,6 +161,8 @@ class GeminiService : public KeyedService {
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+  // Shared by every new tab page showing the widget.
+  TickerPriceCache ticker_price_cache_;
   base::WeakPtrFactory<GeminiService> weak_factory_;
 
   FRIEND_TEST_ALL_PREFIXES(GeminiAPIBrowserTest, GetOAuthClientURL);
@@ -6,7 +6,9 @@
 #include "brave/components/greaselion/browser/greaselion_service_impl.h"
 
 #include <stddef.h>
+#include <algorithm>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,11 +18,16 @@
 #include "base/callback_helpers.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/files/file.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/json/json_file_value_serializer.h"
 #include "base/one_shot_event.h"
 #include "base/sequenced_task_runner.h"
+#include "base/stl_util.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
@@ -50,28 +57,201 @@ namespace {
 
 constexpr char kRunAtDocumentStart[] = "document_start";
 
+// Converted extensions are kept under this directory of the install
+// directory, one subdirectory per content hash.
+constexpr base::FilePath::CharType kConvertedExtensionsDirectory[] =
+    FILE_PATH_LITERAL("Cache");
+
+// Bump this whenever ConvertGreaselionRuleToExtensionOnTaskRunner changes
+// what it writes so that extensions cached by older versions are rebuilt.
+constexpr char kConvertedExtensionFormat[] = "1";
+
+base::FilePath GetConvertedExtensionsDir(const base::FilePath& install_dir) {
+  return install_dir.Append(kConvertedExtensionsDirectory);
+}
+
+// Greaselion scripts are not signed, but the public key for an extension
+// doubles as its unique identity, and we need one of those, so we add the
+// rule name to a known Brave domain and hash the result to create a
+// public key.
+std::string GetPublicKeyForRule(const std::string& rule_name) {
+  char raw[crypto::kSHA256Length] = {0};
+  std::string key;
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
+      !base::FeatureList::IsEnabled(
+          brave_component_updater::kUseDevUpdaterUrl)) {
+    crypto::SHA256HashString(UPDATER_DEV_ENDPOINT + rule_name,
+                             raw,
+                             crypto::kSHA256Length);
+  } else {
+    crypto::SHA256HashString(UPDATER_PROD_ENDPOINT + rule_name,
+                             raw,
+                             crypto::kSHA256Length);
+  }
+  base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
+  return key;
+}
+
+std::string HashString(base::StringPiece contents) {
+  return base::ToLowerASCII(
+      base::HexEncode(crypto::SHA256HashString(contents).data(),
+                      crypto::kSHA256Length));
+}
+
+// Returns the content hash of the file at |path|, or an empty string if it
+// could not be read. Files are only read again once their size or
+// modification time changed since they were added to |file_hashes|.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+std::string GetFileHashOnTaskRunner(
+    const base::FilePath& path,
+    greaselion::GreaselionServiceImpl::FileHashes* file_hashes) {
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info))
+    return std::string();
+
+  auto it = file_hashes->find(path);
+  if (it != file_hashes->end() && it->second.size == info.size &&
+      it->second.last_modified == info.last_modified) {
+    return it->second.hash;
+  }
+
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return std::string();
+  greaselion::GreaselionServiceImpl::FileHash& file_hash = (*file_hashes)[path];
+  file_hash.size = info.size;
+  file_hash.last_modified = info.last_modified;
+  file_hash.hash = HashString(contents);
+  return file_hash.hash;
+}
+
+// Returns a hash of everything that goes into the extension converted from
+// |rule|, or an empty string if one of the rule's files could not be read.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+std::string GetRuleContentHashOnTaskRunner(
+    const greaselion::GreaselionRule& rule,
+    greaselion::GreaselionServiceImpl::FileHashes* file_hashes) {
+  std::string contents;
+  auto append = [&contents](base::StringPiece field) {
+    contents.append(base::NumberToString(field.size()));
+    contents.push_back(':');
+    contents.append(field.data(), field.size());
+  };
+
+  append(kConvertedExtensionFormat);
+  append(GetPublicKeyForRule(rule.name()));
+  append(rule.name());
+  append(rule.run_at());
+  append(base::NumberToString(rule.url_patterns().size()));
+  for (const std::string& url_pattern : rule.url_patterns())
+    append(url_pattern);
+
+  append(base::NumberToString(rule.scripts().size()));
+  for (const base::FilePath& script : rule.scripts()) {
+    const std::string script_hash =
+        GetFileHashOnTaskRunner(script, file_hashes);
+    if (script_hash.empty()) {
+      LOG(ERROR) << "Could not read Greaselion script at path: "
+                 << script.LossyDisplayName();
+      return std::string();
+    }
+    append(script.BaseName().AsUTF8Unsafe());
+    append(script_hash);
+  }
+
+  if (!rule.messages().empty()) {
+    std::vector<base::FilePath> messages;
+    base::FileEnumerator enumerator(rule.messages(), true,
+                                    base::FileEnumerator::FILES);
+    for (base::FilePath path = enumerator.Next(); !path.empty();
+         path = enumerator.Next()) {
+      messages.push_back(path);
+    }
+    std::sort(messages.begin(), messages.end());
+    for (const base::FilePath& path : messages) {
+      base::FilePath relative_path;
+      const std::string message_hash =
+          GetFileHashOnTaskRunner(path, file_hashes);
+      if (!rule.messages().AppendRelativePath(path, &relative_path) ||
+          message_hash.empty()) {
+        LOG(ERROR) << "Could not read Greaselion messages at path: "
+                   << path.LossyDisplayName();
+        return std::string();
+      }
+      append(relative_path.AsUTF8Unsafe());
+      append(message_hash);
+    }
+  }
+
+  return HashString(contents);
+}
+
+// Fills in the content hash of every rule and deletes cached extensions that
+// belong neither to one of these rules nor to |installed_hashes|.
+// |install_dir| belongs to a single profile, so this never removes
+// extensions that another profile still uses.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+greaselion::GreaselionServiceImpl::HashedRules HashRulesOnTaskRunner(
+    greaselion::GreaselionServiceImpl::HashedRules rules,
+    const base::FilePath& install_dir,
+    std::set<std::string> installed_hashes,
+    greaselion::GreaselionServiceImpl::FileHashes* file_hashes) {
+  std::set<std::string> hashes_in_use = std::move(installed_hashes);
+  for (auto& rule : rules) {
+    rule.second = GetRuleContentHashOnTaskRunner(*rule.first, file_hashes);
+    hashes_in_use.insert(rule.second);
+  }
+
+  base::FileEnumerator enumerator(GetConvertedExtensionsDir(install_dir),
+                                  false, base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    if (!base::Contains(hashes_in_use, path.BaseName().AsUTF8Unsafe()))
+      base::DeletePathRecursively(path);
+  }
+  return rules;
+}
+
 // Wraps a Greaselion rule in a component. The component is stored as
-// an unpacked extension in the user data dir. Returns a valid
-// extension that the caller should take ownership of, or nullptr.
+// an unpacked extension in the user data dir, keyed by |content_hash|, and
+// an extension converted earlier from the same content is reused as is.
+// Returns a valid extension that the caller should take ownership of, or
+// nullptr.
 //
 // NOTE: This function does file IO and should not be called on the UI thread.
-// NOTE: The caller takes ownership of the directory at extension->path() on the
-// returned object.
-base::Optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
-ConvertGreaselionRuleToExtensionOnTaskRunner(
+scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
     const greaselion::GreaselionRule& rule,
+    const std::string& content_hash,
     const base::FilePath& install_dir) {
+  const base::FilePath extension_dir =
+      GetConvertedExtensionsDir(install_dir).AppendASCII(content_hash);
+  std::string error;
+  if (base::PathExists(extension_dir.Append(extensions::kManifestFilename))) {
+    scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
+        extension_dir, Manifest::COMPONENT, Extension::NO_FLAGS, &error);
+    if (extension)
+      return extension;
+    LOG(ERROR) << "Could not load cached Greaselion extension, rebuilding it";
+    LOG(ERROR) << error;
+    base::DeletePathRecursively(extension_dir);
+  }
+
   base::FilePath install_temp_dir =
       extensions::file_util::GetInstallTempDir(install_dir);
   if (install_temp_dir.empty()) {
     LOG(ERROR) << "Could not get path to profile temp directory";
-    return base::nullopt;
+    return nullptr;
   }
 
   base::ScopedTempDir temp_dir;
   if (!temp_dir.CreateUniqueTempDirUnderPath(install_temp_dir)) {
     LOG(ERROR) << "Could not create Greaselion temp directory";
-    return base::nullopt;
+    return nullptr;
   }
 
   // Create the manifest
@@ -81,33 +261,12 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   // see kModernManifestVersion in src/extensions/common/extension.cc
   root->SetIntPath(extensions::manifest_keys::kManifestVersion, 2);
 
-  // Create the public key.
-  // Greaselion scripts are not signed, but the public key for an extension
-  // doubles as its unique identity, and we need one of those, so we add the
-  // rule name to a known Brave domain and hash the result to create a
-  // public key.
-  char raw[crypto::kSHA256Length] = {0};
-  std::string key;
   std::string script_name = rule.name();
-  const base::CommandLine& command_line =
-      *base::CommandLine::ForCurrentProcess();
-  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
-      !base::FeatureList::IsEnabled(
-          brave_component_updater::kUseDevUpdaterUrl)) {
-    crypto::SHA256HashString(UPDATER_DEV_ENDPOINT + script_name,
-                             raw,
-                             crypto::kSHA256Length);
-  } else {
-    crypto::SHA256HashString(UPDATER_PROD_ENDPOINT + script_name,
-                             raw,
-                             crypto::kSHA256Length);
-  }
-  base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
-
   root->SetStringPath(extensions::manifest_keys::kName, script_name);
   root->SetStringPath(extensions::manifest_keys::kVersion, "1.0");
   root->SetStringPath(extensions::manifest_keys::kDescription, "");
-  root->SetStringPath(extensions::manifest_keys::kPublicKey, key);
+  root->SetStringPath(extensions::manifest_keys::kPublicKey,
+                      GetPublicKeyForRule(script_name));
   root->SetStringPath("incognito",
                       extensions::manifest_values::kIncognitoNotAllowed);
 
@@ -149,7 +308,7 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   // files to disk.
   if (!serializer.Serialize(*root)) {
     LOG(ERROR) << "Could not write Greaselion manifest";
-    return base::nullopt;
+    return nullptr;
   }
 
   // Copy the messages directory to our extension directory.
@@ -159,7 +318,7 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
             temp_dir.GetPath().AppendASCII("_locales"), true)) {
       LOG(ERROR) << "Could not copy Greaselion messages directory at path: "
                  << rule.messages().LossyDisplayName();
-      return base::nullopt;
+      return nullptr;
     }
   }
 
@@ -169,23 +328,33 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
                         temp_dir.GetPath().Append(script.BaseName()))) {
       LOG(ERROR) << "Could not copy Greaselion script at path: "
           << script.LossyDisplayName();
-      return base::nullopt;
+      return nullptr;
     }
   }
 
-  std::string error;
+  // Only move the extension into the cache once it is complete, so that a
+  // partially written one is never picked up later.
+  if (!base::CreateDirectory(GetConvertedExtensionsDir(install_dir)) ||
+      !base::Move(temp_dir.GetPath(), extension_dir)) {
+    LOG(ERROR) << "Could not move Greaselion extension to "
+               << extension_dir.LossyDisplayName();
+    return nullptr;
+  }
+  // The directory is gone from under |temp_dir| now.
+  ignore_result(temp_dir.Take());
+
   scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
-      temp_dir.GetPath(), Manifest::COMPONENT, Extension::NO_FLAGS, &error);
+      extension_dir, Manifest::COMPONENT, Extension::NO_FLAGS, &error);
   if (!extension.get()) {
     LOG(ERROR) << "Could not load Greaselion extension";
     LOG(ERROR) << error;
-    return base::nullopt;
+    base::DeletePathRecursively(extension_dir);
+    return nullptr;
   }
 
-  // Take ownership of this temporary directory so it's deleted when
-  // the service exits
-  return std::make_pair(extension, std::move(temp_dir));
+  return extension;
 }
+
 }  // namespace
 
 namespace greaselion {
@@ -206,6 +375,7 @@ GreaselionServiceImpl::GreaselionServiceImpl(
       update_pending_(false),
       pending_installs_(0),
       task_runner_(std::move(task_runner)),
+      file_hashes_(new FileHashes, base::OnTaskRunnerDeleter(task_runner_)),
       browser_version_(
           version_info::GetBraveVersionWithoutChromiumMajorVersion()),
       weak_factory_(this) {
@@ -221,13 +391,19 @@ GreaselionServiceImpl::~GreaselionServiceImpl() {
 }
 
 bool GreaselionServiceImpl::IsGreaselionExtension(const std::string& id) {
-  return std::find(greaselion_extensions_.begin(), greaselion_extensions_.end(),
-                   id) != greaselion_extensions_.end();
+  for (const auto& extension : greaselion_extensions_) {
+    if (extension.second == id)
+      return true;
+  }
+  return false;
 }
 
 std::vector<extensions::ExtensionId>
 GreaselionServiceImpl::GetExtensionIdsForTesting() {
-  return greaselion_extensions_;
+  std::vector<extensions::ExtensionId> extension_ids;
+  for (const auto& extension : greaselion_extensions_)
+    extension_ids.push_back(extension.second);
+  return extension_ids;
 }
 
 void GreaselionServiceImpl::UpdateInstalledExtensions() {
@@ -236,75 +412,113 @@ void GreaselionServiceImpl::UpdateInstalledExtensions() {
     return;
   }
   update_in_progress_ = true;
-  if (greaselion_extensions_.empty()) {
-    // No Greaselion extensions are currently installed, so we can move on to
-    // the install phase immediately.
+
+  // Hash every rule, not only the matching ones, so that the extensions of
+  // rules which are toggled off stay cached for when they are toggled back on.
+  HashedRules rules;
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    if (rule->has_unknown_preconditions() == false)
+      rules.emplace_back(std::make_unique<GreaselionRule>(*rule),
+                         std::string());
+  }
+
+  std::set<std::string> installed_hashes;
+  for (const auto& extension : greaselion_extensions_)
+    installed_hashes.insert(extension.first);
+
+  // Hashing reads the rule files, so it must run on the extension file task
+  // runner, which was passed in in the constructor. |file_hashes_| is deleted
+  // on that task runner too, after this task.
+  base::PostTaskAndReplyWithResult(
+      task_runner_.get(), FROM_HERE,
+      base::BindOnce(&HashRulesOnTaskRunner, std::move(rules),
+                     install_directory_, std::move(installed_hashes),
+                     base::Unretained(file_hashes_.get())),
+      base::BindOnce(&GreaselionServiceImpl::OnRulesHashed,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void GreaselionServiceImpl::OnRulesHashed(HashedRules rules) {
+  DCHECK(update_in_progress_);
+  all_rules_installed_successfully_ = true;
+  rules_to_install_.clear();
+
+  std::set<std::string> matching_hashes;
+  for (auto& rule : rules) {
+    if (!rule.first->Matches(state_, browser_version_))
+      continue;
+    if (rule.second.empty()) {
+      all_rules_installed_successfully_ = false;
+      continue;
+    }
+    if (!matching_hashes.insert(rule.second).second)
+      continue;
+    if (!base::Contains(greaselion_extensions_, rule.second))
+      rules_to_install_.push_back(std::move(rule));
+  }
+
+  // Only the extensions whose rule stopped matching, or whose content
+  // changed, are unloaded; everything else stays installed as it is.
+  pending_unloads_.clear();
+  for (const auto& extension : greaselion_extensions_) {
+    if (!base::Contains(matching_hashes, extension.first))
+      pending_unloads_.insert(extension.second);
+  }
+  if (pending_unloads_.empty()) {
     CreateAndInstallExtensions();
     return;
   }
 
-  // Make a copy of greaselion_extensions_ to iterate while the original vector
-  // changes.
-  std::vector<extensions::ExtensionId> extensions = greaselion_extensions_;
-  for (auto id : extensions) {
-    // We need to unload all the Greaselion extensions that are already
-    // installed. OnExtensionUnloaded will be called on each extension, where we
-    // will update the greaselion_extensions_ set. Once it's empty, that
-    // callback will call CreateAndInstallExtensions().
+  // Make a copy of pending_unloads_ to iterate while the original set
+  // changes. OnExtensionUnloaded will be called on each extension, where we
+  // will update greaselion_extensions_ and pending_unloads_. Once the latter
+  // is empty, that callback will call CreateAndInstallExtensions().
+  std::set<extensions::ExtensionId> extension_ids = pending_unloads_;
+  for (const auto& id : extension_ids) {
     extension_service_->UnloadExtension(
         id, extensions::UnloadedExtensionReason::UPDATE);
   }
 }
 
 void GreaselionServiceImpl::CreateAndInstallExtensions() {
-  DCHECK(greaselion_extensions_.empty());
+  DCHECK(pending_unloads_.empty());
   DCHECK(update_in_progress_);
-  all_rules_installed_successfully_ = true;
-  pending_installs_ = 0;
-  std::vector<std::unique_ptr<GreaselionRule>>* rules =
-      download_service_->rules();
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      pending_installs_ += 1;
-    }
-  }
+  pending_installs_ = static_cast<int>(rules_to_install_.size());
   if (!pending_installs_) {
-    // no rules match, nothing else to do
+    // nothing changed, nothing else to do
     MaybeNotifyObservers();
     return;
   }
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      // Convert script file to component extension. This must run on extension
-      // file task runner, which was passed in in the constructor.
-      GreaselionRule rule_copy(*rule);
-      base::PostTaskAndReplyWithResult(
-          task_runner_.get(), FROM_HERE,
-          base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
-                         rule_copy, install_directory_),
-          base::BindOnce(&GreaselionServiceImpl::PostConvert,
-                         weak_factory_.GetWeakPtr()));
-    }
+  HashedRules rules = std::move(rules_to_install_);
+  rules_to_install_.clear();
+  for (const auto& rule : rules) {
+    // Convert script file to component extension. This must run on extension
+    // file task runner, which was passed in in the constructor.
+    GreaselionRule rule_copy(*rule.first);
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
+                       rule_copy, rule.second, install_directory_),
+        base::BindOnce(&GreaselionServiceImpl::PostConvert,
+                       weak_factory_.GetWeakPtr(), rule.second));
   }
 }
 
 void GreaselionServiceImpl::PostConvert(
-    base::Optional<GreaselionConvertedExtension> converted_extension) {
-  if (!converted_extension) {
+    const std::string& content_hash,
+    scoped_refptr<extensions::Extension> extension) {
+  if (!extension) {
     all_rules_installed_successfully_ = false;
     pending_installs_ -= 1;
     MaybeNotifyObservers();
     LOG(ERROR) << "Could not load Greaselion script";
   } else {
-    greaselion_extensions_.push_back(converted_extension->first->id());
-    extension_dirs_.push_back(std::move(converted_extension->second));
+    greaselion_extensions_[content_hash] = extension->id();
     extension_system_->ready().Post(
         FROM_HERE,
         base::BindOnce(&GreaselionServiceImpl::Install,
-                       weak_factory_.GetWeakPtr(),
-                       base::Passed(&converted_extension->first)));
+                       weak_factory_.GetWeakPtr(), std::move(extension)));
   }
 }
 
@@ -316,9 +530,7 @@ void GreaselionServiceImpl::Install(
 void GreaselionServiceImpl::OnExtensionReady(
     content::BrowserContext* browser_context,
     const extensions::Extension* extension) {
-  auto index = std::find(greaselion_extensions_.begin(),
-                         greaselion_extensions_.end(), extension->id());
-  if (index == greaselion_extensions_.end()) {
+  if (!IsGreaselionExtension(extension->id())) {
     // not one of ours
     return;
   }
@@ -331,14 +543,18 @@ void GreaselionServiceImpl::OnExtensionUnloaded(
     content::BrowserContext* browser_context,
     const extensions::Extension* extension,
     extensions::UnloadedExtensionReason reason) {
-  auto index = std::find(greaselion_extensions_.begin(),
-                         greaselion_extensions_.end(), extension->id());
-  if (index == greaselion_extensions_.end()) {
+  auto it = std::find_if(
+      greaselion_extensions_.begin(), greaselion_extensions_.end(),
+      [extension](const auto& installed) {
+        return installed.second == extension->id();
+      });
+  if (it == greaselion_extensions_.end()) {
     // not one of ours
     return;
   }
-  greaselion_extensions_.erase(index);
-  if (update_in_progress_ && greaselion_extensions_.empty()) {
+  greaselion_extensions_.erase(it);
+  if (update_in_progress_ && pending_unloads_.erase(extension->id()) &&
+      pending_unloads_.empty()) {
     // It's time!
     CreateAndInstallExtensions();
   }
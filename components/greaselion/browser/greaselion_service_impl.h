@@ -8,24 +8,23 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base/files/file_path.h"
-#include "base/files/scoped_temp_dir.h"
 #include "base/macros.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/path_service.h"
+#include "base/sequenced_task_runner.h"
+#include "base/time/time.h"
 #include "base/version.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "extensions/common/extension_id.h"
 #include "url/gurl.h"
 
-namespace base {
-class SequencedTaskRunner;
-}
-
 namespace extensions {
 class Extension;
 class ExtensionRegistry;
@@ -36,6 +35,7 @@ class ExtensionSystem;
 namespace greaselion {
 
 class GreaselionDownloadService;
+class GreaselionRule;
 
 class GreaselionServiceImpl : public GreaselionService {
  public:
@@ -63,14 +63,25 @@ class GreaselionServiceImpl : public GreaselionService {
                            const extensions::Extension* extension,
                            extensions::UnloadedExtensionReason reason) override;
 
-  using GreaselionConvertedExtension =
-      std::pair<scoped_refptr<extensions::Extension>, base::ScopedTempDir>;
+  // Rules paired with the content hash of the extension converted from them.
+  using HashedRules =
+      std::vector<std::pair<std::unique_ptr<GreaselionRule>, std::string>>;
+
+  // Content hash of a rule file, valid while the file keeps the size and
+  // modification time it had when it was hashed.
+  struct FileHash {
+    int64_t size = 0;
+    base::Time last_modified;
+    std::string hash;
+  };
+  using FileHashes = std::map<base::FilePath, FileHash>;
 
  private:
   void SetBrowserVersionForTesting(const base::Version& version) override;
+  void OnRulesHashed(HashedRules rules);
   void CreateAndInstallExtensions();
-  void PostConvert(
-      base::Optional<GreaselionConvertedExtension> converted_extension);
+  void PostConvert(const std::string& content_hash,
+                   scoped_refptr<extensions::Extension> extension);
   void Install(scoped_refptr<extensions::Extension> extension);
   void MaybeNotifyObservers();
 
@@ -86,8 +97,12 @@ class GreaselionServiceImpl : public GreaselionService {
   int pending_installs_;
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   base::ObserverList<Observer> observers_;
-  std::vector<extensions::ExtensionId> greaselion_extensions_;
-  std::vector<base::ScopedTempDir> extension_dirs_;
+  // Installed extensions keyed by the content hash of their rule.
+  std::map<std::string, extensions::ExtensionId> greaselion_extensions_;
+  std::set<extensions::ExtensionId> pending_unloads_;
+  HashedRules rules_to_install_;
+  // Only used, and destroyed, on |task_runner_|.
+  std::unique_ptr<FileHashes, base::OnTaskRunnerDeleter> file_hashes_;
   base::Version browser_version_;
   base::WeakPtrFactory<GreaselionServiceImpl> weak_factory_;
 
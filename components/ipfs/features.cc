@@ -20,5 +20,11 @@ const base::Feature kIpfsFeature{
 #endif
 };
 
+// Sends top-level ipfs:// navigations to both the local node and the public
+// gateway when the local node is configured, and uses whichever answers
+// first.
+const base::Feature kIpfsGatewayRace{"IpfsGatewayRace",
+                                     base::FEATURE_DISABLED_BY_DEFAULT};
+
 }  // namespace features
 }  // namespace ipfs
@@ -32,6 +32,7 @@
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
 #include "net/http/http_status_code.h"
+#include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "url/gurl.h"
@@ -61,6 +62,39 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     )");
 }
 
+net::NetworkTrafficAnnotationTag GetGatewayRaceTrafficAnnotationTag() {
+  return net::DefineNetworkTrafficAnnotation("ipfs_gateway_race", R"(
+      semantics {
+        sender: "IPFS service"
+        description:
+          "Asks the local IPFS node and the public IPFS gateway for the same "
+          "content to pick the one that can serve it first."
+        trigger:
+          "Triggered by navigating to an ipfs:// or ipns:// URL."
+        data:
+          "The requested IPFS path."
+        destination: WEBSITE
+      }
+      policy {
+        cookies_allowed: NO
+        setting:
+          "This request is only made when the IpfsGatewayRace feature is "
+          "enabled. It can be turned off with "
+          "--disable-features=IpfsGatewayRace."
+        policy_exception_justification:
+          "Not implemented."
+      }
+    )");
+}
+
+// Number of races whose winning gateway is remembered.
+constexpr size_t kMaxCachedGatewayRaces = 256;
+
+// Gateways that have not answered by then lose the race, so that the caller
+// falls back to its configured gateway instead of stalling the navigation.
+constexpr base::TimeDelta kGatewayRaceTimeout =
+    base::TimeDelta::FromSeconds(15);
+
 std::pair<bool, std::string> LoadConfigFileOnFileTaskRunner(
     const base::FilePath& path) {
   std::string data;
@@ -90,6 +124,8 @@ IpfsService::IpfsService(content::BrowserContext* context,
           {base::ThreadPool(), base::MayBlock(),
            base::TaskPriority::BEST_EFFORT,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      winning_gateways_(kMaxCachedGatewayRaces),
+      gateway_race_timeout_(kGatewayRaceTimeout),
       ipfs_p3a(this, context),
       weak_factory_(this) {
   DCHECK(!user_data_dir.empty());
@@ -420,6 +456,10 @@ void IpfsService::RunLaunchDaemonCallbackForTest(bool result) {
   NotifyDaemonLaunchCallbacks(result);
 }
 
+void IpfsService::SetGatewayRaceTimeoutForTest(base::TimeDelta timeout) {
+  gateway_race_timeout_ = timeout;
+}
+
 void IpfsService::SetSkipGetConnectedPeersCallbackForTest(bool skip) {
   skip_get_connected_peers_callback_for_test_ = skip;
 }
@@ -562,4 +602,93 @@ void IpfsService::OnGarbageCollection(
   std::move(callback).Run(success && error.empty(), error);
 }
 
+IpfsService::GatewayRace::GatewayRace() = default;
+IpfsService::GatewayRace::~GatewayRace() = default;
+
+void IpfsService::RaceGateways(const GURL& ipfs_uri,
+                               const GURL& local_gateway,
+                               const GURL& public_gateway,
+                               RaceGatewaysCallback callback) {
+  std::string cid;
+  if (!GetCIDFromIPFSURI(ipfs_uri, &cid)) {
+    std::move(callback).Run(GURL());
+    return;
+  }
+
+  // The winner depends on which gateways raced, so it is only reused for
+  // the same pair; changing either gateway pref starts a new race.
+  std::string cache_key;
+  if (ipfs_uri.SchemeIs(kIPFSScheme)) {
+    cache_key = base::JoinString(
+        {cid, local_gateway.spec(), public_gateway.spec()}, " ");
+    auto cached = winning_gateways_.Get(cache_key);
+    if (cached != winning_gateways_.end()) {
+      std::move(callback).Run(cached->second);
+      return;
+    }
+  }
+
+  auto race = gateway_races_.insert(gateway_races_.begin(), GatewayRace());
+  race->cid = cid;
+  race->cache_key = cache_key;
+  race->callback = std::move(callback);
+
+  for (const GURL& gateway : {local_gateway, public_gateway}) {
+    GURL url;
+    if (!TranslateIPFSURI(ipfs_uri, &url, gateway, false))
+      continue;
+    auto request = std::make_unique<network::ResourceRequest>();
+    request->url = url;
+    request->method = "HEAD";
+    request->credentials_mode = network::mojom::CredentialsMode::kOmit;
+    auto iter = url_loaders_.insert(
+        url_loaders_.begin(),
+        network::SimpleURLLoader::Create(
+            std::move(request), GetGatewayRaceTrafficAnnotationTag()));
+    iter->get()->SetTimeoutDuration(gateway_race_timeout_);
+    race->pending++;
+    iter->get()->DownloadHeadersOnly(
+        url_loader_factory_.get(),
+        base::BindOnce(&IpfsService::OnGatewayRaceResponse,
+                       base::Unretained(this), iter, race, gateway));
+  }
+
+  if (!race->pending) {
+    std::move(race->callback).Run(GURL());
+    gateway_races_.erase(race);
+  }
+}
+
+void IpfsService::OnGatewayRaceResponse(
+    SimpleURLLoaderList::iterator iter,
+    GatewayRaceList::iterator race,
+    const GURL& gateway,
+    scoped_refptr<net::HttpResponseHeaders> headers) {
+  url_loaders_.erase(iter);
+  race->pending--;
+
+  // A gateway has the content if it answers with the IPFS path of the
+  // requested CID, which is what both go-ipfs and public gateways send.
+  std::string ipfs_path;
+  const bool valid =
+      headers && headers->response_code() == net::HTTP_OK &&
+      headers->GetNormalizedHeader("x-ipfs-path", &ipfs_path) &&
+      (base::StartsWith(ipfs_path, "/ipfs/" + race->cid,
+                        base::CompareCase::SENSITIVE) ||
+       base::StartsWith(ipfs_path, "/ipns/" + race->cid,
+                        base::CompareCase::SENSITIVE));
+
+  if (race->callback && valid) {
+    VLOG(1) << "IPFS gateway race for " << race->cid << " won by " << gateway;
+    if (!race->cache_key.empty())
+      winning_gateways_.Put(race->cache_key, gateway);
+    std::move(race->callback).Run(gateway);
+  } else if (race->callback && !race->pending) {
+    std::move(race->callback).Run(GURL());
+  }
+
+  if (!race->pending)
+    gateway_races_.erase(race);
+}
+
 }  // namespace ipfs
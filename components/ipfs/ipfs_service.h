@@ -12,9 +12,11 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
 #include "base/containers/queue.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/observer_list.h"
+#include "base/time/time.h"
 #include "brave/components/ipfs/addresses_config.h"
 #include "brave/components/ipfs/brave_ipfs_client_updater.h"
 #include "brave/components/ipfs/ipfs_constants.h"
@@ -35,6 +37,10 @@ namespace content {
 class BrowserContext;
 }  // namespace content
 
+namespace net {
+class HttpResponseHeaders;
+}  // namespace net
+
 namespace network {
 class SharedURLLoaderFactory;
 class SimpleURLLoader;
@@ -71,6 +77,7 @@ class IpfsService : public KeyedService,
   using LaunchDaemonCallback = base::OnceCallback<void(bool)>;
   using ShutdownDaemonCallback = base::OnceCallback<void(bool)>;
   using GetConfigCallback = base::OnceCallback<void(bool, const std::string&)>;
+  using RaceGatewaysCallback = base::OnceCallback<void(const GURL&)>;
 
   void AddObserver(IpfsServiceObserver* observer);
   void RemoveObserver(IpfsServiceObserver* observer);
@@ -95,6 +102,15 @@ class IpfsService : public KeyedService,
   void GetRepoStats(GetRepoStatsCallback callback);
   void GetNodeInfo(GetNodeInfoCallback callback);
   void RunGarbageCollection(GarbageCollectionCallback callback);
+  // Requests |ipfs_uri| from |local_gateway| and |public_gateway| at the same
+  // time and runs |callback| with the gateway that first answered for the
+  // requested CID, or with an empty GURL if neither did in time. Winners for
+  // ipfs:// URIs are remembered per CID and pair of gateways since their
+  // content is immutable.
+  void RaceGateways(const GURL& ipfs_uri,
+                    const GURL& local_gateway,
+                    const GURL& public_gateway,
+                    RaceGatewaysCallback callback);
 
   void SetAllowIpfsLaunchForTest(bool launched);
   void SetServerEndpointForTest(const GURL& gurl);
@@ -102,6 +118,7 @@ class IpfsService : public KeyedService,
   bool WasConnectedPeersCalledForTest() const;
   void SetGetConnectedPeersCalledForTest(bool value);
   void RunLaunchDaemonCallbackForTest(bool result);
+  void SetGatewayRaceTimeoutForTest(base::TimeDelta timeout);
 
  protected:
   void OnConfigLoaded(GetConfigCallback, const std::pair<bool, std::string>&);
@@ -110,6 +127,17 @@ class IpfsService : public KeyedService,
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
 
+  struct GatewayRace {
+    GatewayRace();
+    ~GatewayRace();
+    std::string cid;
+    // Key of the winner in |winning_gateways_|, empty for ipns:// URIs.
+    std::string cache_key;
+    int pending = 0;
+    RaceGatewaysCallback callback;
+  };
+  using GatewayRaceList = std::list<GatewayRace>;
+
   // BraveIpfsClientUpdater::Observer
   void OnExecutableReady(const base::FilePath& path) override;
   void OnInstallationEvent(ComponentUpdaterEvents event) override;
@@ -139,6 +167,10 @@ class IpfsService : public KeyedService,
   void OnGarbageCollection(SimpleURLLoaderList::iterator iter,
                            GarbageCollectionCallback callback,
                            std::unique_ptr<std::string> response_body);
+  void OnGatewayRaceResponse(SimpleURLLoaderList::iterator iter,
+                             GatewayRaceList::iterator race,
+                             const GURL& gateway,
+                             scoped_refptr<net::HttpResponseHeaders> headers);
 
   // The remote to the ipfs service running on an utility process. The browser
   // will not launch a new ipfs service process if this remote is already
@@ -151,6 +183,9 @@ class IpfsService : public KeyedService,
 
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+  GatewayRaceList gateway_races_;
+  base::MRUCache<std::string, GURL> winning_gateways_;
+  base::TimeDelta gateway_race_timeout_;
 
   base::queue<LaunchDaemonCallback> pending_launch_callbacks_;
 
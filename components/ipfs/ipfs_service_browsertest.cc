@@ -7,6 +7,7 @@
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/strings/strcat.h"
+#include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "brave/browser/ipfs/ipfs_service_factory.h"
 #include "brave/common/brave_paths.h"
@@ -685,4 +686,104 @@ IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, TopLevelAutoRedirectsOff) {
   EXPECT_EQ(contents->GetURL().host(), other_gateway.host());
 }
 
+namespace {
+
+constexpr char kRaceCID[] =
+    "bafybeiemxf5abjwjbikoz4mc3a3dla6ual3jsgpdr4cjr3oz3evfyavhwq";
+
+std::unique_ptr<net::test_server::HttpResponse> HandleGatewayWithContent(
+    const net::test_server::HttpRequest& request) {
+  auto http_response = std::make_unique<net::test_server::BasicHttpResponse>();
+  http_response->set_code(net::HTTP_OK);
+  http_response->AddCustomHeader("X-Ipfs-Path", request.GetURL().path());
+  return http_response;
+}
+
+std::unique_ptr<net::test_server::HttpResponse> HandleGatewayWithoutContent(
+    const net::test_server::HttpRequest& request) {
+  return std::make_unique<net::test_server::HungResponse>();
+}
+
+std::unique_ptr<net::test_server::HttpResponse> HandleGatewayNotFound(
+    const net::test_server::HttpRequest& request) {
+  auto http_response = std::make_unique<net::test_server::BasicHttpResponse>();
+  http_response->set_code(net::HTTP_NOT_FOUND);
+  return http_response;
+}
+
+GURL RaceGatewaysAndWait(IpfsService* service,
+                         const GURL& ipfs_uri,
+                         const GURL& local_gateway,
+                         const GURL& public_gateway) {
+  base::RunLoop run_loop;
+  GURL winner;
+  service->RaceGateways(ipfs_uri, local_gateway, public_gateway,
+                        base::BindLambdaForTesting([&](const GURL& gateway) {
+                          winner = gateway;
+                          run_loop.Quit();
+                        }));
+  run_loop.Run();
+  return winner;
+}
+
+}  // namespace
+
+IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, RaceGatewaysFirstValidWins) {
+  net::EmbeddedTestServer slow_gateway;
+  slow_gateway.RegisterRequestHandler(
+      base::BindRepeating(&HandleGatewayWithoutContent));
+  ASSERT_TRUE(slow_gateway.Start());
+  net::EmbeddedTestServer fast_gateway;
+  fast_gateway.RegisterRequestHandler(
+      base::BindRepeating(&HandleGatewayWithContent));
+  ASSERT_TRUE(fast_gateway.Start());
+
+  const GURL ipfs_uri(base::StrCat({"ipfs://", kRaceCID, "/index.html"}));
+  EXPECT_EQ(RaceGatewaysAndWait(ipfs_service(), ipfs_uri,
+                                slow_gateway.base_url(),
+                                fast_gateway.base_url()),
+            fast_gateway.base_url());
+
+  // The winner is remembered for the CID and gateways, so the same race is
+  // answered without asking the gateways again.
+  const GURL slow_gateway_url = slow_gateway.base_url();
+  const GURL fast_gateway_url = fast_gateway.base_url();
+  ASSERT_TRUE(slow_gateway.ShutdownAndWaitUntilComplete());
+  ASSERT_TRUE(fast_gateway.ShutdownAndWaitUntilComplete());
+  EXPECT_EQ(RaceGatewaysAndWait(ipfs_service(), ipfs_uri, slow_gateway_url,
+                                fast_gateway_url),
+            fast_gateway_url);
+
+  // Other gateways race again instead of reusing the old winner.
+  EXPECT_TRUE(RaceGatewaysAndWait(ipfs_service(), ipfs_uri,
+                                  GURL("http://local.invalid/"),
+                                  GURL("http://public.invalid/"))
+                  .is_empty());
+}
+
+IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, RaceGatewaysTimesOut) {
+  net::EmbeddedTestServer gateway;
+  gateway.RegisterRequestHandler(
+      base::BindRepeating(&HandleGatewayWithoutContent));
+  ASSERT_TRUE(gateway.Start());
+
+  ipfs_service()->SetGatewayRaceTimeoutForTest(
+      base::TimeDelta::FromMilliseconds(100));
+  const GURL ipfs_uri(base::StrCat({"ipfs://", kRaceCID}));
+  EXPECT_TRUE(RaceGatewaysAndWait(ipfs_service(), ipfs_uri,
+                                  gateway.base_url(), gateway.base_url())
+                  .is_empty());
+}
+
+IN_PROC_BROWSER_TEST_F(IpfsServiceBrowserTest, RaceGatewaysNoValidResponse) {
+  net::EmbeddedTestServer gateway;
+  gateway.RegisterRequestHandler(base::BindRepeating(&HandleGatewayNotFound));
+  ASSERT_TRUE(gateway.Start());
+
+  const GURL ipfs_uri(base::StrCat({"ipfs://", kRaceCID}));
+  EXPECT_TRUE(RaceGatewaysAndWait(ipfs_service(), ipfs_uri,
+                                  gateway.base_url(), gateway.base_url())
+                  .is_empty());
+}
+
 }  // namespace ipfs
@@ -252,4 +252,17 @@ bool TranslateIPFSURI(const GURL& url,
   return false;
 }
 
+bool GetCIDFromIPFSURI(const GURL& url, std::string* cid) {
+  DCHECK(cid);
+  if (!TranslateIPFSURI(url, nullptr, GURL(), false))
+    return false;
+
+  // TranslateIPFSURI only accepts ipfs://[cid]/path, which is parsed as an
+  // empty host and a //[cid]/path path.
+  const std::string path = url.path();
+  const size_t pos = path.find('/', 2);
+  *cid = path.substr(2, pos == std::string::npos ? pos : pos - 2);
+  return !cid->empty();
+}
+
 }  // namespace ipfs
@@ -49,6 +49,8 @@ bool TranslateIPFSURI(const GURL& url,
                       GURL* new_url,
                       const GURL& gateway_url,
                       bool use_subdomain);
+// Extracts the CID (or IPNS name) from an ipfs:// or ipns:// URI.
+bool GetCIDFromIPFSURI(const GURL& url, std::string* cid);
 
 }  // namespace ipfs
 
@@ -481,3 +481,18 @@ TEST_F(IpfsUtilsUnitTest,
                  "yavhwq.ipfs.localhost:48080/wiki/Vincent_van_Gogh.html"
                  "?test=true#test"));
 }
+
+TEST_F(IpfsUtilsUnitTest, GetCIDFromIPFSURI) {
+  std::string cid;
+  ASSERT_TRUE(ipfs::GetCIDFromIPFSURI(
+      GURL("ipfs://bafybeiemxf5abjwjbikoz4mc3a3dla6ual3jsgpdr4cjr3oz3evfyavhwq"
+           "/wiki/Vincent_van_Gogh.html?test=true#test"),
+      &cid));
+  EXPECT_EQ(cid, "bafybeiemxf5abjwjbikoz4mc3a3dla6ual3jsgpdr4cjr3oz3evfyavhwq");
+
+  ASSERT_TRUE(ipfs::GetCIDFromIPFSURI(GURL("ipns://brave.eth"), &cid));
+  EXPECT_EQ(cid, "brave.eth");
+
+  EXPECT_FALSE(ipfs::GetCIDFromIPFSURI(GURL("https://dweb.link/ipfs/abc"),
+                                       &cid));
+}
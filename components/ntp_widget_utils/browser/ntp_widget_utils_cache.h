@@ -0,0 +1,148 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_WIDGET_UTILS_BROWSER_NTP_WIDGET_UTILS_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_WIDGET_UTILS_BROWSER_NTP_WIDGET_UTILS_CACHE_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/callback.h"
+#include "base/containers/mru_cache.h"
+#include "base/location.h"
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "base/time/time.h"
+
+namespace ntp_widget_utils {
+
+// Caches the parsed responses of one widget endpoint, keyed by request.
+//
+// Data younger than |ttl| is served from memory. Data younger than
+// |ttl| + |max_stale| is served from memory while a refresh is started in the
+// background. Otherwise callers wait for a fetch, and concurrent callers for
+// the same key share a single request. At most |max_entries| keys are kept,
+// evicting the least recently used.
+template <typename T>
+class DataCache {
+ public:
+  using ResultCallback = base::OnceCallback<void(const T& value, bool success)>;
+  // Unsuccessful results are passed on to waiting callers but not cached.
+  using FetchCallback = base::OnceCallback<void(const T& value, bool success)>;
+  // Starts a request for the key, returning false if it could not be started.
+  using Fetcher = base::OnceCallback<bool(FetchCallback callback)>;
+
+  DataCache(base::TimeDelta ttl, base::TimeDelta max_stale, size_t max_entries)
+      : ttl_(ttl), max_stale_(max_stale), entries_(max_entries) {}
+  ~DataCache() = default;
+
+  // Runs |callback| with the data for |key|, calling |fetcher| if the cached
+  // data is missing or out of date. Callbacks never run synchronously.
+  bool Get(const std::string& key, Fetcher fetcher, ResultCallback callback) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    auto it = entries_.Get(key);
+    if (it != entries_.end()) {
+      const base::TimeDelta age = now - it->second.fetched_time;
+      if (age < ttl_ + max_stale_) {
+        base::SequencedTaskRunnerHandle::Get()->PostTask(
+            FROM_HERE,
+            base::BindOnce(std::move(callback), it->second.value, true));
+        const PendingKey pending_key(generation_, key);
+        if (age >= ttl_ && !pending_callbacks_.count(pending_key)) {
+          pending_callbacks_[pending_key];
+          if (!StartFetch(key, std::move(fetcher)))
+            pending_callbacks_.erase(pending_key);
+        }
+        return true;
+      }
+      entries_.Erase(it);
+    }
+
+    const PendingKey pending_key(generation_, key);
+    auto pending_it = pending_callbacks_.find(pending_key);
+    if (pending_it != pending_callbacks_.end()) {
+      pending_it->second.push_back(std::move(callback));
+      return true;
+    }
+
+    pending_callbacks_[pending_key].push_back(std::move(callback));
+    if (!StartFetch(key, std::move(fetcher))) {
+      pending_callbacks_.erase(pending_key);
+      return false;
+    }
+    return true;
+  }
+
+  // Drops all cached data, for example when the account changes. Requests
+  // in flight still answer the callers that were waiting for them, but are
+  // not cached or shared with callers that come after.
+  void Clear() {
+    entries_.Clear();
+    ++generation_;
+  }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    T value;
+    base::TimeTicks fetched_time;
+  };
+
+  // Pending fetches are keyed by the generation they were started in, so
+  // that a fetch started before Clear() is not joined after it.
+  using PendingKey = std::pair<int, std::string>;
+
+  bool StartFetch(const std::string& key, Fetcher fetcher) {
+    return std::move(fetcher).Run(base::BindOnce(&DataCache::OnFetched,
+                                                 weak_factory_.GetWeakPtr(),
+                                                 key, generation_));
+  }
+
+  void OnFetched(const std::string& key,
+                 int generation,
+                 const T& value,
+                 bool success) {
+    if (success && generation == generation_)
+      entries_.Put(key, Entry{value, base::TimeTicks::Now()});
+
+    auto it = pending_callbacks_.find(PendingKey(generation, key));
+    if (it == pending_callbacks_.end())
+      return;
+    std::vector<ResultCallback> callbacks = std::move(it->second);
+    pending_callbacks_.erase(it);
+    for (auto& callback : callbacks)
+      std::move(callback).Run(value, success);
+  }
+
+  const base::TimeDelta ttl_;
+  const base::TimeDelta max_stale_;
+  base::MRUCache<std::string, Entry> entries_;
+  // Callers waiting for the fetch in flight for each key. A key with an empty
+  // list is being refreshed in the background.
+  std::map<PendingKey, std::vector<ResultCallback>> pending_callbacks_;
+  int generation_ = 0;
+  base::WeakPtrFactory<DataCache> weak_factory_{this};
+
+  DISALLOW_COPY_AND_ASSIGN(DataCache);
+};
+
+// Adapts a callback that does not need to know whether the fetch succeeded.
+template <typename T>
+typename DataCache<T>::ResultCallback IgnoreSuccess(
+    base::OnceCallback<void(const T&)> callback) {
+  return base::BindOnce(
+      [](base::OnceCallback<void(const T&)> callback, const T& value,
+         bool success) { std::move(callback).Run(value); },
+      std::move(callback));
+}
+
+}  // namespace ntp_widget_utils
+
+#endif  // BRAVE_COMPONENTS_NTP_WIDGET_UTILS_BROWSER_NTP_WIDGET_UTILS_CACHE_H_
@@ -0,0 +1,166 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_widget_utils/browser/ntp_widget_utils_cache.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=NTPWidgetUtilsCacheTest.*
+
+namespace {
+
+constexpr base::TimeDelta kTTL = base::TimeDelta::FromMinutes(1);
+constexpr base::TimeDelta kMaxStale = base::TimeDelta::FromMinutes(5);
+
+}  // namespace
+
+class NTPWidgetUtilsCacheTest : public testing::Test {
+ public:
+  NTPWidgetUtilsCacheTest() : cache_(kTTL, kMaxStale, 2) {}
+
+ protected:
+  // Stands in for a widget endpoint, holding requests until answered.
+  ntp_widget_utils::DataCache<std::string>::Fetcher MakeFetcher() {
+    return base::BindOnce(
+        [](NTPWidgetUtilsCacheTest* test,
+           ntp_widget_utils::DataCache<std::string>::FetchCallback callback) {
+          test->fetches_.push_back(std::move(callback));
+          return true;
+        },
+        base::Unretained(this));
+  }
+
+  void Get(const std::string& key) {
+    cache_.Get(key, MakeFetcher(),
+               base::BindOnce(
+                   [](std::vector<std::string>* results,
+                      const std::string& value, bool success) {
+                     results->push_back(success ? value : "<failed>");
+                   },
+                   &results_));
+  }
+
+  void Respond(size_t index, const std::string& value, bool success) {
+    std::move(fetches_[index]).Run(value, success);
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  ntp_widget_utils::DataCache<std::string> cache_;
+  std::vector<ntp_widget_utils::DataCache<std::string>::FetchCallback>
+      fetches_;
+  std::vector<std::string> results_;
+};
+
+TEST_F(NTPWidgetUtilsCacheTest, SharesRequestsInFlight) {
+  Get("BTC");
+  Get("BTC");
+  Get("ETH");
+
+  Respond(0, "btc", true);
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(2u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"btc", "btc"}), results_);
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, ServesFreshDataWithoutFetching) {
+  Get("BTC");
+  Respond(0, "btc", true);
+
+  task_environment_.FastForwardBy(kTTL / 2);
+  Get("BTC");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(1u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"btc", "btc"}), results_);
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, ServesStaleDataWhileRevalidating) {
+  Get("BTC");
+  Respond(0, "old", true);
+  task_environment_.FastForwardBy(kTTL * 2);
+
+  Get("BTC");
+  Get("BTC");
+  task_environment_.RunUntilIdle();
+  Respond(1, "new", true);
+  Get("BTC");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(2u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"old", "old", "old", "new"}), results_);
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, FetchesDataOlderThanMaxStale) {
+  Get("BTC");
+  Respond(0, "old", true);
+  task_environment_.FastForwardBy(kTTL + kMaxStale);
+
+  Get("BTC");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(2u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"old"}), results_);
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, DoesNotCacheFailures) {
+  Get("BTC");
+  Respond(0, "", false);
+
+  Get("BTC");
+
+  EXPECT_EQ(2u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"<failed>"}), results_);
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, EvictsLeastRecentlyUsedEntries) {
+  Get("BTC");
+  Respond(0, "btc", true);
+  Get("ETH");
+  Respond(1, "eth", true);
+  Get("BTC");
+
+  Get("BAT");
+  Respond(2, "bat", true);
+
+  EXPECT_EQ(2u, cache_.size());
+  Get("BTC");
+  Get("ETH");
+  EXPECT_EQ(4u, fetches_.size());
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, DoesNotCacheResponsesRequestedBeforeClear) {
+  Get("BTC");
+
+  cache_.Clear();
+  Respond(0, "btc", true);
+  Get("BTC");
+
+  EXPECT_EQ(2u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"btc"}), results_);
+}
+
+TEST_F(NTPWidgetUtilsCacheTest, DoesNotShareRequestsStartedBeforeClear) {
+  Get("BTC");
+
+  cache_.Clear();
+  Get("BTC");
+  EXPECT_EQ(2u, fetches_.size());
+
+  Respond(0, "old", true);
+  Respond(1, "new", true);
+  Get("BTC");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(2u, fetches_.size());
+  EXPECT_EQ(std::vector<std::string>({"old", "new", "new"}), results_);
+}
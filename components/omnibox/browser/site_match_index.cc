@@ -0,0 +1,78 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_match_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/strings/string_util.h"
+
+SiteMatchIndex::SiteMatchIndex(std::vector<std::string> sites)
+    : sites_(std::move(sites)) {
+  for (uint32_t site = 0; site < sites_.size(); ++site) {
+    for (uint32_t offset = 0; offset < sites_[site].length(); ++offset)
+      suffixes_.push_back({site, offset});
+  }
+  std::sort(suffixes_.begin(), suffixes_.end(),
+            [this](const Suffix& a, const Suffix& b) {
+              return SuffixAt(a) < SuffixAt(b);
+            });
+}
+
+SiteMatchIndex::~SiteMatchIndex() = default;
+
+std::vector<SiteMatchIndex::Match> SiteMatchIndex::FindMatches(
+    base::StringPiece input,
+    size_t max_matches) const {
+  return Find(input, max_matches, false);
+}
+
+std::vector<SiteMatchIndex::Match> SiteMatchIndex::FindPrefixMatches(
+    base::StringPiece input,
+    size_t max_matches) const {
+  return Find(input, max_matches, true);
+}
+
+base::StringPiece SiteMatchIndex::SuffixAt(const Suffix& suffix) const {
+  return base::StringPiece(sites_[suffix.site]).substr(suffix.offset);
+}
+
+std::vector<SiteMatchIndex::Match> SiteMatchIndex::Find(
+    base::StringPiece input,
+    size_t max_matches,
+    bool prefix_only) const {
+  std::vector<Match> matches;
+  if (input.empty() || max_matches == 0)
+    return matches;
+
+  // All suffixes starting with |input| form one contiguous run.
+  auto it = std::lower_bound(suffixes_.begin(), suffixes_.end(), input,
+                             [this](const Suffix& suffix,
+                                    base::StringPiece value) {
+                               return SuffixAt(suffix) < value;
+                             });
+  std::vector<Suffix> hits;
+  for (; it != suffixes_.end() &&
+         base::StartsWith(SuffixAt(*it), input, base::CompareCase::SENSITIVE);
+       ++it) {
+    if (!prefix_only || it->offset == 0)
+      hits.push_back(*it);
+  }
+
+  // Order by list position, which is also the rank, keeping the first
+  // occurrence in each site.
+  std::sort(hits.begin(), hits.end(), [](const Suffix& a, const Suffix& b) {
+    return a.site != b.site ? a.site < b.site : a.offset < b.offset;
+  });
+  for (const auto& hit : hits) {
+    if (!matches.empty() && matches.back().index == hit.site)
+      continue;
+    if (matches.size() >= max_matches)
+      break;
+    matches.push_back({hit.site, hit.offset});
+  }
+  return matches;
+}
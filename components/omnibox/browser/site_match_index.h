@@ -0,0 +1,64 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
+#define BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_piece.h"
+
+// Substring index over a fixed list of lowercase site strings, built once and
+// shared by the omnibox providers that match typed input against static
+// lists. Lookups binary search a suffix array instead of scanning every entry
+// on each keystroke.
+class SiteMatchIndex {
+ public:
+  struct Match {
+    // Position of the site in the list the index was built from.
+    size_t index;
+    // Offset of the first occurrence of the input in the site.
+    size_t offset;
+  };
+
+  explicit SiteMatchIndex(std::vector<std::string> sites);
+  ~SiteMatchIndex();
+
+  SiteMatchIndex(const SiteMatchIndex&) = delete;
+  SiteMatchIndex& operator=(const SiteMatchIndex&) = delete;
+
+  // Returns up to |max_matches| sites that contain |input|, in list order,
+  // each with the offset of the first occurrence of |input|.
+  std::vector<Match> FindMatches(base::StringPiece input,
+                                 size_t max_matches) const;
+
+  // Like FindMatches() but only returns sites that start with |input|.
+  std::vector<Match> FindPrefixMatches(base::StringPiece input,
+                                       size_t max_matches) const;
+
+  const std::string& site(size_t index) const { return sites_[index]; }
+  size_t size() const { return sites_.size(); }
+
+ private:
+  struct Suffix {
+    uint32_t site;
+    uint32_t offset;
+  };
+
+  base::StringPiece SuffixAt(const Suffix& suffix) const;
+  std::vector<Match> Find(base::StringPiece input,
+                          size_t max_matches,
+                          bool prefix_only) const;
+
+  const std::vector<std::string> sites_;
+  // Every suffix of every site, sorted lexicographically.
+  std::vector<Suffix> suffixes_;
+};
+
+#endif  // BRAVE_COMPONENTS_OMNIBOX_BROWSER_SITE_MATCH_INDEX_H_
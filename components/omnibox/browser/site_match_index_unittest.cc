@@ -0,0 +1,86 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/omnibox/browser/site_match_index.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const std::vector<std::string> kSites = {
+    "google.com",   "mail.google.com", "youtube.com", "wikipedia.org",
+    "amazon.com",   "amazon.ca",       "github.com",  "gitlab.com",
+    "bitbucket.org", "coinbase.com",   "bitcoin.org", "go.dev"};
+
+// Reference implementation matching what the providers used to do.
+std::vector<SiteMatchIndex::Match> LinearScan(const std::string& input,
+                                              size_t max_matches) {
+  std::vector<SiteMatchIndex::Match> matches;
+  for (size_t i = 0; i < kSites.size() && matches.size() < max_matches; ++i) {
+    size_t pos = kSites[i].find(input);
+    if (pos != std::string::npos)
+      matches.push_back({i, pos});
+  }
+  return matches;
+}
+
+}  // namespace
+
+TEST(SiteMatchIndexTest, FindMatches) {
+  SiteMatchIndex index(kSites);
+  auto matches = index.FindMatches("google", 10);
+  ASSERT_EQ(2UL, matches.size());
+  EXPECT_EQ(0UL, matches[0].index);
+  EXPECT_EQ(0UL, matches[0].offset);
+  EXPECT_EQ(1UL, matches[1].index);
+  EXPECT_EQ(5UL, matches[1].offset);
+
+  // Only the first occurrence in a site is reported.
+  matches = index.FindMatches("o", 10);
+  ASSERT_FALSE(matches.empty());
+  EXPECT_EQ(0UL, matches[0].index);
+  EXPECT_EQ(1UL, matches[0].offset);
+
+  EXPECT_EQ(3UL, index.FindMatches("o", 3).size());
+  EXPECT_TRUE(index.FindMatches("", 10).empty());
+  EXPECT_TRUE(index.FindMatches("brave", 10).empty());
+  EXPECT_TRUE(index.FindMatches("google.com.", 10).empty());
+}
+
+TEST(SiteMatchIndexTest, FindPrefixMatches) {
+  SiteMatchIndex index(kSites);
+  auto matches = index.FindPrefixMatches("bit", 10);
+  ASSERT_EQ(2UL, matches.size());
+  EXPECT_EQ("bitbucket.org", index.site(matches[0].index));
+  EXPECT_EQ("bitcoin.org", index.site(matches[1].index));
+
+  // "coin" occurs inside bitcoin.org but only coinbase.com starts with it.
+  matches = index.FindPrefixMatches("coin", 10);
+  ASSERT_EQ(1UL, matches.size());
+  EXPECT_EQ("coinbase.com", index.site(matches[0].index));
+}
+
+// Replays typing each site one character at a time and checks the index
+// agrees with a plain scan for every keystroke.
+TEST(SiteMatchIndexTest, TypedSequencesMatchLinearScan) {
+  SiteMatchIndex index(kSites);
+  for (const auto& site : kSites) {
+    for (size_t length = 1; length <= site.length(); ++length) {
+      const std::string input = site.substr(0, length);
+      for (size_t max_matches : std::vector<size_t>{1, 3, kSites.size()}) {
+        auto expected = LinearScan(input, max_matches);
+        auto actual = index.FindMatches(input, max_matches);
+        ASSERT_EQ(expected.size(), actual.size()) << input;
+        for (size_t i = 0; i < expected.size(); ++i) {
+          EXPECT_EQ(expected[i].index, actual[i].index) << input;
+          EXPECT_EQ(expected[i].offset, actual[i].offset) << input;
+        }
+      }
+    }
+  }
+}
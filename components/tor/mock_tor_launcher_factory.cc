@@ -13,3 +13,7 @@ MockTorLauncherFactory& MockTorLauncherFactory::GetInstance() {
 
 MockTorLauncherFactory::MockTorLauncherFactory() = default;
 MockTorLauncherFactory::~MockTorLauncherFactory() = default;
+
+void MockTorLauncherFactory::StartBootstrapTimerForTesting() {
+  launch_time_ = base::TimeTicks::Now();
+}
@@ -26,6 +26,9 @@ class MockTorLauncherFactory : public TorLauncherFactory {
   MOCK_METHOD(bool, IsTorConnected, (), (const override));
   MOCK_METHOD(std::string, GetTorProxyURI, (), (const override));
 
+  // Starts timing the bootstrap like a real launch would.
+  void StartBootstrapTimerForTesting();
+
  private:
   friend class base::NoDestructor<MockTorLauncherFactory>;
 
@@ -14,6 +14,10 @@ extern const char kTorDisabled[];
 // Automatically open onion available site or .onion domain in Tor window
 extern const char kAutoOnionRedirect[];
 
+// Launch tor in the background after startup so the first Tor window doesn't
+// wait for the full bootstrap.
+extern const char kTorPrewarm[];
+
 }  // namespace prefs
 }  // namespace tor
 
@@ -5,10 +5,22 @@
 
 #include "brave/components/tor/tor_constants.h"
 
+#include "base/logging.h"
+
 #define FPL FILE_PATH_LITERAL
 
 namespace tor {
 
 const base::FilePath::CharType kTorProfileDir[] = FPL("Tor Profile");
 
+base::FilePath GetTorDataPath(const base::FilePath& user_data_dir) {
+  DCHECK(!user_data_dir.empty());
+  return user_data_dir.Append(FPL("tor")).Append(FPL("data"));
+}
+
+base::FilePath GetTorWatchPath(const base::FilePath& user_data_dir) {
+  DCHECK(!user_data_dir.empty());
+  return user_data_dir.Append(FPL("tor")).Append(FPL("watch"));
+}
+
 }  // namespace tor
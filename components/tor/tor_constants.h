@@ -17,6 +17,12 @@ extern const base::FilePath::CharType kTorProfileDir[];
 
 constexpr char kTorProfileID[] = "Tor::Profile";
 
+// Tor data and watch directories under |user_data_dir|. Shared by every
+// launcher of the tor daemon so a pre-warmed process is reused by the first
+// Tor window.
+base::FilePath GetTorDataPath(const base::FilePath& user_data_dir);
+base::FilePath GetTorWatchPath(const base::FilePath& user_data_dir);
+
 }  // namespace tor
 
 #endif  // BRAVE_COMPONENTS_TOR_TOR_CONSTANTS_H_
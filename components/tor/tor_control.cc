@@ -860,7 +860,8 @@ void TorControl::WriteDone(int rv) {
 
 // StartRead()
 //
-//      Create an I/O buffer to read command responses into.
+//      Create an I/O buffer to read command responses into, or rewind
+//      the one left over from the previous read cycle.
 //
 //      Caller must ensure reading_ is true and that there are
 //      synchronous command callbacks or asynchronous event
@@ -870,8 +871,11 @@ void TorControl::StartRead() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   DCHECK(reading_);
   DCHECK(!cmdq_.empty() || !async_events_.empty());
-  readiobuf_ = base::MakeRefCounted<net::GrowableIOBuffer>();
-  readiobuf_->SetCapacity(kTorBufferSize);
+  if (!readiobuf_) {
+    readiobuf_ = base::MakeRefCounted<net::GrowableIOBuffer>();
+    readiobuf_->SetCapacity(kTorBufferSize);
+  }
+  readiobuf_->set_offset(0);
   read_start_ = 0;
   DCHECK(readiobuf_->RemainingCapacity());
 }
@@ -941,40 +945,44 @@ void TorControl::ReadDone(int rv) {
     Error();
     return;
   }
-  const char* data = readiobuf_->data();
-  for (int i = 0; i < rv; i++) {
-    if (!read_cr_) {
-      // No CR yet.  Accept CR or non-LF; reject LF.
-      if (data[i] == 0x0d) {  // CR
-        read_cr_ = true;
-      } else if (data[i] == 0x0a) {  // LF
-        VLOG(1) << "tor: stray line feed";
-        Error();
-        return;
-      } else {
-        // Anything else: Just accept it and move on.
-      }
-    } else {
+  // Scan for CR with memchr rather than byte by byte; lines are
+  // handed to ReadLine() as views into readiobuf_ without copying.
+  char* const base = readiobuf_->StartOfBuffer();
+  const char* p = readiobuf_->data();
+  const char* const end = p + rv;
+  while (p < end) {
+    if (read_cr_) {
       // CR seen.  Accept LF; reject all else.
-      if (data[i] == 0x0a) {  // LF
-        // CRLF seen, so we must have i >= 2.  Emit a line and advance
-        // to the next one, unless anything went wrong with the line.
-        assert(i >= 1);
-        std::string line(readiobuf_->StartOfBuffer() + read_start_,
-                         readiobuf_->offset() + i - 1 - read_start_);
-        read_start_ = readiobuf_->offset() + i + 1;
-        read_cr_ = false;
-        if (!ReadLine(line)) {
-          reading_ = false;
-          return;
-        }
-      } else {
-        // CR seen, but not LF.  Bad.
+      if (*p != 0x0a) {
         VLOG(1) << "tor: stray carriage return";
         Error();
         return;
       }
+      // CRLF seen.  Emit a line and advance to the next one, unless
+      // anything went wrong with the line.
+      const char* line_start = base + read_start_;
+      base::StringPiece line(line_start, p - 1 - line_start);
+      read_start_ = p + 1 - base;
+      read_cr_ = false;
+      p++;
+      if (!ReadLine(line)) {
+        reading_ = false;
+        return;
+      }
+      continue;
+    }
+
+    // No CR yet.  Find the next one; any LF before it is a stray.
+    const char* cr = static_cast<const char*>(memchr(p, 0x0d, end - p));
+    if (memchr(p, 0x0a, (cr ? cr : end) - p)) {
+      VLOG(1) << "tor: stray line feed";
+      Error();
+      return;
     }
+    if (!cr)
+      break;
+    read_cr_ = true;
+    p = cr + 1;
   }
 
   // If we've walked up to the end of the buffer, try shifting it to
@@ -1001,11 +1009,10 @@ void TorControl::ReadDone(int rv) {
 
   // If we've processed every byte in the input so far, and there's no
   // more command callbacks queued or asynchronous events registered,
-  // stop.
+  // stop.  Keep readiobuf_ around for the next read cycle.
   if (read_start_ == readiobuf_->offset() && cmdq_.empty() &&
       async_events_.empty()) {
     reading_ = false;
-    readiobuf_.reset();
     read_start_ = 0;
     read_cr_ = false;
     return;
@@ -1017,7 +1024,7 @@ void TorControl::ReadDone(int rv) {
 //      We have read a line of input; process it.  Return true on
 //      success, false on error.
 //
-bool TorControl::ReadLine(const std::string& line) {
+bool TorControl::ReadLine(base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
 
   if (line.size() < 4) {
@@ -1032,26 +1039,27 @@ bool TorControl::ReadLine(const std::string& line) {
   // intermediate reply and ` ' for a final reply.
   //
   // TODO(riastradh): parse or check syntax of status
-  std::string status(line, 0, 3);
+  const std::string status = line.substr(0, 3).as_string();
   char pos = line[3];
-  std::string reply(line, 4);
+  const base::StringPiece reply = line.substr(4);
 
   // Determine whether it is an asynchronous reply, status 6yz.
   if (status[0] == '6') {
     // Notify delegate of the raw reply.
-    NotifyTorRawAsync(status, reply);
+    NotifyTorRawAsync(status, reply.as_string());
 
     // Is this a new async reply?
     if (!async_) {
       // Parse the keyword and the initial line.
       const size_t sp = reply.find(' ');
-      std::string event_name, initial;
-      if (sp == std::string::npos) {
+      base::StringPiece event_name, initial;
+      if (sp == base::StringPiece::npos) {
         event_name = reply;
       } else {
         event_name = reply.substr(0, sp);
         initial = reply.substr(sp + 1);
       }
+      const TorControlEvent event = ParseTorControlEvent(event_name);
 
       // Discriminate on the position of the reply.
       switch (pos) {
@@ -1059,12 +1067,10 @@ bool TorControl::ReadLine(const std::string& line) {
           // Single-line async reply.
 
           // Bail if we don't recognize the event name.
-          const auto& found = kTorControlEventByName.find(event_name);
-          if (found == kTorControlEventByName.end()) {
+          if (event == TorControlEvent::INVALID) {
             VLOG(1) << "tor: unknown event: " << event_name;  // XXX escape
             return false;
           }
-          const TorControlEvent event = (*found).second;
 
           // Ignore if we don't think we're subscribed to this.
           if (!async_events_.count(event)) {
@@ -1074,7 +1080,7 @@ bool TorControl::ReadLine(const std::string& line) {
 
           // Notify the delegate of the parsed reply.  No extra
           // because there were no intermediate reply lines.
-          NotifyTorEvent(event, initial, {});
+          NotifyTorEvent(event, initial.as_string(), {});
 
           return true;
         }
@@ -1083,13 +1089,9 @@ bool TorControl::ReadLine(const std::string& line) {
 
           // Start a fresh async reply state.  Parse the rest, but
           // skip it, if we don't recognize the event.
-          const auto& found = kTorControlEventByName.find(event_name);
-          const TorControlEvent event =
-              (found == kTorControlEventByName.end() ? TorControlEvent::INVALID
-                                                     : (*found).second);
           async_ = std::make_unique<Async>();
           async_->event = event;
-          async_->initial = initial;
+          async_->initial = initial.as_string();
           async_->skip = (event == TorControlEvent::INVALID);
           return true;
         }
@@ -1158,10 +1160,10 @@ bool TorControl::ReadLine(const std::string& line) {
     // the queue.
     switch (pos) {
       case '-':
-        NotifyTorRawMid(status, reply);
+        NotifyTorRawMid(status, reply.as_string());
         if (!cmdq_.empty()) {
           PerLineCallback& perline = cmdq_.front().first;
-          perline.Run(status, reply);
+          perline.Run(status, reply.as_string());
         }
         return true;
       case '+':
@@ -1169,11 +1171,11 @@ bool TorControl::ReadLine(const std::string& line) {
         // XXX Just ignore it for now.
         return true;
       case ' ':
-        NotifyTorRawEnd(status, reply);
+        NotifyTorRawEnd(status, reply.as_string());
         if (!cmdq_.empty()) {
           CmdCallback& callback = cmdq_.front().second;
           bool error = false;
-          std::move(callback).Run(error, status, reply);
+          std::move(callback).Run(error, status, reply.as_string());
           cmdq_.pop();
         }
         return true;
@@ -1330,7 +1332,7 @@ void TorControl::NotifyTorRawEnd(const std::string& status,
 //      success, false on failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value) {
   size_t end;
@@ -1345,20 +1347,20 @@ bool TorControl::ParseKV(const std::string& string,
 //      failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value,
                          size_t* end) {
   DCHECK(key && value && end);
   // Search for `=' -- it had better be there.
-  size_t eq = string.find("=");
-  if (eq == std::string::npos)
+  size_t eq = string.find('=');
+  if (eq == base::StringPiece::npos)
     return false;
   size_t vstart = eq + 1;
 
   // If we're at the end of the string, value is empt.
   if (vstart == string.size()) {
-    *key = string.substr(0, eq);
+    *key = string.substr(0, eq).as_string();
     *value = "";
     *end = string.size();
     return true;
@@ -1368,7 +1370,7 @@ bool TorControl::ParseKV(const std::string& string,
   if (string[vstart] != '"') {
     // Not quoted.  Check for a delimiter.
     size_t i, vend = string.size();
-    if ((i = string.find(" ", vstart)) != std::string::npos) {
+    if ((i = string.find(' ', vstart)) != base::StringPiece::npos) {
       // Delimited.  Stop at the delimiter, and consume it.
       vend = i;
       *end = vend + 1;
@@ -1378,19 +1380,19 @@ bool TorControl::ParseKV(const std::string& string,
     }
 
     // Check for internal quotes; they are forbidden.
-    if ((i = string.find("\"", vstart)) != std::string::npos)
+    if ((i = string.find('"', vstart)) != base::StringPiece::npos)
       return false;
 
     // Extract the key and value and we're done.
-    *key = string.substr(0, eq);
-    *value = string.substr(vstart, vend - vstart);
+    *key = string.substr(0, eq).as_string();
+    *value = string.substr(vstart, vend - vstart).as_string();
     return true;
   }
 
   // Quoted string.  Parse it, and consume trailing spaces.
   if (!ParseQuoted(string.substr(eq + 1), value, end))
     return false;
-  *key = string.substr(0, eq);
+  *key = string.substr(0, eq).as_string();
   *end += eq + 1;
   while (*end < string.size() && string[*end] == ' ')
     (*end)++;
@@ -1405,7 +1407,7 @@ bool TorControl::ParseKV(const std::string& string,
 //      return false on failure.
 //
 // static
-bool TorControl::ParseQuoted(const std::string& string,
+bool TorControl::ParseQuoted(base::StringPiece string,
                              std::string* value,
                              size_t* end) {
   enum {
@@ -1530,7 +1532,7 @@ bool TorControl::ParseQuoted(const std::string& string,
       case REJECT:
         return false;
       case ACCEPT:
-        *value = buf.substr(0, pos);
+        value->assign(buf, 0, pos);
         *end = i + 1;
         return true;
       default:
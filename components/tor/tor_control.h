@@ -20,6 +20,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/observer_list.h"
 #include "base/process/process.h"
+#include "base/strings/string_piece.h"
 #include "base/time/time.h"
 
 namespace base {
@@ -100,15 +101,16 @@ class TorControl {
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseQuoted);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseKV);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadLine);
+  FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadDone);
 
-  static bool ParseKV(const std::string& string,
+  static bool ParseKV(base::StringPiece string,
                       std::string* key,
                       std::string* value);
-  static bool ParseKV(const std::string& string,
+  static bool ParseKV(base::StringPiece string,
                       std::string* key,
                       std::string* value,
                       size_t* end);
-  static bool ParseQuoted(const std::string& string,
+  static bool ParseQuoted(base::StringPiece string,
                           std::string* value,
                           size_t* end);
 
@@ -137,7 +139,7 @@ class TorControl {
   // Read state machine.
   std::queue<std::pair<PerLineCallback, CmdCallback>> cmdq_;
   bool reading_;
-  scoped_refptr<net::GrowableIOBuffer> readiobuf_;
+  scoped_refptr<net::GrowableIOBuffer> readiobuf_;  // reused across reads
   int read_start_;  // offset where the current line starts
   bool read_cr_;    // true if we have parsed a CR
 
@@ -231,7 +233,7 @@ class TorControl {
   void DoReads();
   void ReadDoneAsync(int rv);
   void ReadDone(int rv);
-  bool ReadLine(const std::string& line);
+  bool ReadLine(base::StringPiece line);
 
   void Error();
 
@@ -5,6 +5,9 @@
 
 #include "brave/components/tor/tor_control_event.h"
 
+#include "base/containers/flat_map.h"
+#include "base/no_destructor.h"
+
 namespace tor {
 
 const std::map<std::string, TorControlEvent> kTorControlEventByName = {
@@ -20,4 +23,18 @@ const std::map<TorControlEvent, std::string> kTorControlEventByEnum = {
 #undef TOR_EVENT
 };
 
+TorControlEvent ParseTorControlEvent(base::StringPiece name) {
+  static const base::NoDestructor<
+      base::flat_map<base::StringPiece, TorControlEvent>>
+      kEventByName({
+#define TOR_EVENT(N) {#N, TorControlEvent::N},
+#include "tor_control_event_list.h"  // NOLINT
+#undef TOR_EVENT
+      });
+  const auto found = kEventByName->find(name);
+  if (found == kEventByName->end())
+    return TorControlEvent::INVALID;
+  return found->second;
+}
+
 }  // namespace tor
@@ -9,6 +9,8 @@
 #include <map>
 #include <string>
 
+#include "base/strings/string_piece.h"
+
 namespace tor {
 
 enum class TorControlEvent {
@@ -21,6 +23,10 @@ enum class TorControlEvent {
 extern const std::map<std::string, TorControlEvent> kTorControlEventByName;
 extern const std::map<TorControlEvent, std::string> kTorControlEventByEnum;
 
+// Decodes an event keyword from a 6xx reply line without allocating.
+// Returns TorControlEvent::INVALID for unknown keywords.
+TorControlEvent ParseTorControlEvent(base::StringPiece name);
+
 }  // namespace tor
 
 #endif  // BRAVE_COMPONENTS_TOR_TOR_CONTROL_EVENT_H_
@@ -5,8 +5,11 @@
 
 #include "brave/components/tor/tor_control.h"
 
+#include <cstring>
+
 #include "base/callback_helpers.h"
 #include "base/run_loop.h"
+#include "net/base/io_buffer.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
@@ -179,4 +182,66 @@ TEST(TorControlTest, ReadLine) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST(TorControlTest, ParseTorControlEvent) {
+  EXPECT_EQ(ParseTorControlEvent("CIRC"), TorControlEvent::CIRC);
+  EXPECT_EQ(ParseTorControlEvent("CIRC_BW"), TorControlEvent::CIRC_BW);
+  EXPECT_EQ(ParseTorControlEvent("STATUS_CLIENT"),
+            TorControlEvent::STATUS_CLIENT);
+  EXPECT_EQ(ParseTorControlEvent("CIRC 1000"), TorControlEvent::INVALID);
+  EXPECT_EQ(ParseTorControlEvent("circ"), TorControlEvent::INVALID);
+  EXPECT_EQ(ParseTorControlEvent(""), TorControlEvent::INVALID);
+}
+
+TEST(TorControlTest, ReadDone) {
+  content::BrowserTaskEnvironment task_environment;
+
+  MockTorControlDelegate delegate;
+  std::unique_ptr<TorControl> control = TorControl::Create(&delegate);
+
+  using tor::TorControlEvent;
+  std::map<std::string, std::string> circ_extra = {{"PURPOSE", "GENERAL"}};
+  EXPECT_CALL(delegate, OnTorRawAsync("650", testing::_)).Times(4);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::CIRC, "1 BUILT",
+                                   testing::IsEmpty()))
+      .Times(1);
+  EXPECT_CALL(delegate,
+              OnTorEvent(TorControlEvent::CIRC, "2 EXTENDED", circ_extra))
+      .Times(1);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::BW, "10 20",
+                                   testing::IsEmpty()))
+      .Times(1);
+  content::GetIOThreadTaskRunner({})->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](std::unique_ptr<TorControl> control) {
+            control->async_events_[TorControlEvent::CIRC] = 1;
+            control->async_events_[TorControlEvent::BW] = 1;
+            control->reading_ = true;
+            control->StartRead();
+            // Feed the transcript in chunks that split lines, including
+            // between CR and LF.
+            const char* chunks[] = {
+                "650 CIRC 1 BU", "ILT\r", "\n650-CIRC 2 EXTENDED\r\n650 PU",
+                "RPOSE=GENERAL\r\n650 BW 10 20\r\n",
+            };
+            for (const char* chunk : chunks) {
+              const int len = strlen(chunk);
+              memcpy(control->readiobuf_->data(), chunk, len);
+              control->ReadDone(len);
+              EXPECT_TRUE(control->reading_);
+            }
+            EXPECT_EQ(control->read_start_, control->readiobuf_->offset());
+
+            // A bare LF is rejected.
+            const char stray[] = "650 BW 1 2\n";
+            memcpy(control->readiobuf_->data(), stray, strlen(stray));
+            control->ReadDone(strlen(stray));
+            EXPECT_FALSE(control->reading_);
+          },
+          std::move(control)));
+
+  EXPECT_CALL(delegate, OnTorClosed()).Times(1);
+  base::RunLoop().RunUntilIdle();
+}
+
 }  // namespace tor
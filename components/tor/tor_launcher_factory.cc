@@ -10,6 +10,7 @@
 #include "base/bind.h"
 #include "base/files/file_util.h"
 #include "base/process/kill.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/task/post_task.h"
 #include "brave/components/tor/service_sandbox_type.h"
 #include "brave/components/tor/tor_launcher_observer.h"
@@ -96,6 +97,7 @@ void TorLauncherFactory::LaunchTorProcess(const tor::mojom::TorConfig& config) {
   DCHECK(!config.tor_data_path.empty());
   DCHECK(!config.tor_watch_path.empty());
   config_ = config;
+  launch_time_ = base::TimeTicks::Now();
 
   // Tor launcher could be null if we created Tor process and killed it
   // through KillTorProcess function before. So we need to initialize
@@ -137,6 +139,7 @@ void TorLauncherFactory::KillTorProcess() {
   tor_launcher_.reset();
   tor_pid_ = -1;
   is_connected_ = false;
+  launch_time_ = base::TimeTicks();
 }
 
 int64_t TorLauncherFactory::GetTorPid() const {
@@ -311,6 +314,11 @@ void TorLauncherFactory::OnTorEvent(
         observer.OnTorInitializing(percentage);
     } else if (initial.find(kStatusClientCircuitEstablished) !=
                std::string::npos) {
+      if (!launch_time_.is_null()) {
+        UMA_HISTOGRAM_LONG_TIMES("Brave.Tor.TimeToFirstCircuit",
+                                 base::TimeTicks::Now() - launch_time_);
+        launch_time_ = base::TimeTicks();
+      }
       for (auto& observer : observers_)
         observer.OnTorCircuitEstablished(true);
       is_connected_ = true;
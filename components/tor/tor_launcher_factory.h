@@ -17,6 +17,7 @@
 #include "base/memory/singleton.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
+#include "base/time/time.h"
 #include "brave/components/services/tor/public/interfaces/tor.mojom.h"
 #include "brave/components/tor/tor_control.h"
 #include "mojo/public/cpp/bindings/remote.h"
@@ -90,6 +91,10 @@ class TorLauncherFactory : public tor::TorControl::Delegate {
 
   int64_t tor_pid_;
 
+  // Set when a launch is requested and cleared once the first circuit is
+  // established, to record the time to the first circuit.
+  base::TimeTicks launch_time_;
+
   tor::mojom::TorConfig config_;
 
   base::ObserverList<TorLauncherObserver> observers_;
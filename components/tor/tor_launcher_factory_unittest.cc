@@ -0,0 +1,56 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/tor/tor_launcher_factory.h"
+
+#include <string>
+
+#include "base/test/metrics/histogram_tester.h"
+#include "base/time/time.h"
+#include "brave/components/tor/mock_tor_launcher_factory.h"
+#include "brave/components/tor/tor_control_event.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+constexpr char kTimeToFirstCircuitHistogram[] = "Brave.Tor.TimeToFirstCircuit";
+}  // namespace
+
+class TorLauncherFactoryTest : public testing::Test {
+ public:
+  TorLauncherFactoryTest() = default;
+  ~TorLauncherFactoryTest() override = default;
+
+ protected:
+  void SendStatusClient(const std::string& initial) {
+    MockTorLauncherFactory::GetInstance().OnTorEvent(
+        tor::TorControlEvent::STATUS_CLIENT, initial, {});
+  }
+
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  base::HistogramTester histogram_tester_;
+};
+
+TEST_F(TorLauncherFactoryTest, RecordsTimeToFirstCircuitOnce) {
+  MockTorLauncherFactory::GetInstance().StartBootstrapTimerForTesting();
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(4));
+  SendStatusClient("NOTICE BOOTSTRAP PROGRESS=50 TAG=loading_descriptors");
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(6));
+  SendStatusClient("NOTICE CIRCUIT_ESTABLISHED");
+  // Circuits rebuilt later on are not part of the bootstrap.
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(30));
+  SendStatusClient("NOTICE CIRCUIT_ESTABLISHED");
+
+  histogram_tester_.ExpectUniqueTimeSample(
+      kTimeToFirstCircuitHistogram, base::TimeDelta::FromSeconds(10), 1);
+}
+
+TEST_F(TorLauncherFactoryTest, DoesNotRecordWithoutLaunch) {
+  SendStatusClient("NOTICE CIRCUIT_ESTABLISHED");
+
+  histogram_tester_.ExpectTotalCount(kTimeToFirstCircuitHistogram, 0);
+}
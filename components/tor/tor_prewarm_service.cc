@@ -0,0 +1,78 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/tor/tor_prewarm_service.h"
+
+#include "brave/components/services/tor/public/interfaces/tor.mojom.h"
+#include "brave/components/tor/pref_names.h"
+#include "brave/components/tor/tor_constants.h"
+#include "brave/components/tor/tor_launcher_factory.h"
+#include "components/prefs/pref_service.h"
+
+namespace tor {
+
+TorPrewarmService::TorPrewarmService(PrefService* local_state,
+                                     BraveTorClientUpdater* tor_client_updater,
+                                     const base::FilePath& user_data_dir)
+    : local_state_(local_state),
+      tor_client_updater_(tor_client_updater),
+      user_data_dir_(user_data_dir),
+      tor_launcher_factory_(TorLauncherFactory::GetInstance()),
+      observing_(false) {}
+
+TorPrewarmService::~TorPrewarmService() {
+  if (observing_)
+    tor_client_updater_->RemoveObserver(this);
+}
+
+void TorPrewarmService::Start() {
+  if (!tor_client_updater_ || !IsPrewarmEnabled())
+    return;
+
+  if (!observing_) {
+    tor_client_updater_->AddObserver(this);
+    observing_ = true;
+  }
+  // No-op when already registered, the executable will be reported through
+  // OnExecutableReady once the component is installed.
+  tor_client_updater_->Register();
+
+  if (!tor_client_updater_->GetExecutablePath().empty())
+    LaunchTor();
+}
+
+void TorPrewarmService::SetTorLauncherFactoryForTest(
+    TorLauncherFactory* factory) {
+  if (!factory)
+    return;
+  tor_launcher_factory_ = factory;
+}
+
+bool TorPrewarmService::IsPrewarmEnabled() const {
+  if (!local_state_)
+    return false;
+  return local_state_->GetBoolean(prefs::kTorPrewarm) &&
+         !local_state_->GetBoolean(prefs::kTorDisabled);
+}
+
+void TorPrewarmService::LaunchTor() {
+  if (tor_launcher_factory_->GetTorPid() >= 0)
+    return;
+
+  VLOG(1) << "Pre-warming tor";
+  tor::mojom::TorConfig config(tor_client_updater_->GetExecutablePath(),
+                               GetTorDataPath(user_data_dir_),
+                               GetTorWatchPath(user_data_dir_));
+  tor_launcher_factory_->LaunchTorProcess(config);
+}
+
+void TorPrewarmService::OnExecutableReady(const base::FilePath& path) {
+  if (path.empty() || !IsPrewarmEnabled())
+    return;
+
+  LaunchTor();
+}
+
+}  // namespace tor
@@ -0,0 +1,52 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_TOR_TOR_PREWARM_SERVICE_H_
+#define BRAVE_COMPONENTS_TOR_TOR_PREWARM_SERVICE_H_
+
+#include "base/files/file_path.h"
+#include "brave/components/tor/brave_tor_client_updater.h"
+
+class PrefService;
+class TorLauncherFactory;
+
+namespace tor {
+
+// Bootstraps the tor daemon ahead of the first Tor window when
+// prefs::kTorPrewarm is set. Start() is expected to be called once the
+// browser is idle after startup. The launched process uses the same data
+// directory as TorProfileServiceImpl, so tor's cached consensus is reused and
+// the first Tor profile picks up the already running daemon.
+class TorPrewarmService : public BraveTorClientUpdater::Observer {
+ public:
+  TorPrewarmService(PrefService* local_state,
+                    BraveTorClientUpdater* tor_client_updater,
+                    const base::FilePath& user_data_dir);
+  ~TorPrewarmService() override;
+
+  void Start();
+
+  void SetTorLauncherFactoryForTest(TorLauncherFactory* factory);
+
+ private:
+  bool IsPrewarmEnabled() const;
+  void LaunchTor();
+
+  // BraveTorClientUpdater::Observer
+  void OnExecutableReady(const base::FilePath& path) override;
+
+  PrefService* local_state_;                  // NOT OWNED
+  BraveTorClientUpdater* tor_client_updater_;  // NOT OWNED
+  base::FilePath user_data_dir_;
+  TorLauncherFactory* tor_launcher_factory_;  // Singleton
+  bool observing_;
+
+  TorPrewarmService(const TorPrewarmService&) = delete;
+  TorPrewarmService& operator=(const TorPrewarmService&) = delete;
+};
+
+}  // namespace tor
+
+#endif  // BRAVE_COMPONENTS_TOR_TOR_PREWARM_SERVICE_H_
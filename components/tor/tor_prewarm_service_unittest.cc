@@ -0,0 +1,117 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/tor/tor_prewarm_service.h"
+
+#include <memory>
+
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/test/scoped_command_line.h"
+#include "brave/components/tor/brave_tor_client_updater.h"
+#include "brave/components/tor/mock_tor_launcher_factory.h"
+#include "brave/components/tor/pref_names.h"
+#include "brave/components/tor/tor_constants.h"
+#include "brave/components/tor/tor_profile_service.h"
+#include "brave/components/tor/tor_switches.h"
+#include "components/prefs/testing_pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using testing::_;
+using testing::AllOf;
+using testing::Field;
+using testing::Return;
+
+namespace tor {
+
+namespace {
+const base::FilePath::CharType kUserDataDir[] = FILE_PATH_LITERAL("/user");
+const base::FilePath::CharType kTorBinary[] = FILE_PATH_LITERAL("/tor/tor");
+}  // namespace
+
+class TorPrewarmServiceTest : public testing::Test {
+ public:
+  TorPrewarmServiceTest() = default;
+  ~TorPrewarmServiceTest() override = default;
+
+  void SetUp() override {
+    // Keep the component updater out of the way, the executable is reported
+    // to the service directly.
+    scoped_command_line_.GetProcessCommandLine()->AppendSwitch(
+        kDisableTorClientUpdaterExtension);
+    TorProfileService::RegisterLocalStatePrefs(local_state_.registry());
+    tor_client_updater_ = std::make_unique<BraveTorClientUpdater>(
+        nullptr, &local_state_, base::FilePath(kUserDataDir));
+    service_ = std::make_unique<TorPrewarmService>(
+        &local_state_, tor_client_updater_.get(), base::FilePath(kUserDataDir));
+    service_->SetTorLauncherFactoryForTest(launcher_factory());
+    ON_CALL(*launcher_factory(), GetTorPid()).WillByDefault(Return(-1));
+  }
+
+  void TearDown() override {
+    service_.reset();
+    tor_client_updater_.reset();
+    testing::Mock::VerifyAndClearExpectations(launcher_factory());
+  }
+
+  MockTorLauncherFactory* launcher_factory() {
+    return &MockTorLauncherFactory::GetInstance();
+  }
+
+  void ExecutableReady() {
+    static_cast<BraveTorClientUpdater::Observer*>(service_.get())
+        ->OnExecutableReady(base::FilePath(kTorBinary));
+  }
+
+ protected:
+  content::BrowserTaskEnvironment task_environment_;
+  base::test::ScopedCommandLine scoped_command_line_;
+  TestingPrefServiceSimple local_state_;
+  std::unique_ptr<BraveTorClientUpdater> tor_client_updater_;
+  std::unique_ptr<TorPrewarmService> service_;
+};
+
+TEST_F(TorPrewarmServiceTest, DisabledByDefault) {
+  EXPECT_CALL(*launcher_factory(), LaunchTorProcess(_)).Times(0);
+  service_->Start();
+  ExecutableReady();
+}
+
+TEST_F(TorPrewarmServiceTest, LaunchesWhenExecutableReady) {
+  local_state_.SetBoolean(prefs::kTorPrewarm, true);
+  const base::FilePath user_data_dir(kUserDataDir);
+  EXPECT_CALL(
+      *launcher_factory(),
+      LaunchTorProcess(
+          AllOf(Field(&mojom::TorConfig::binary_path,
+                      base::FilePath(kTorBinary)),
+                Field(&mojom::TorConfig::tor_data_path,
+                      GetTorDataPath(user_data_dir)),
+                Field(&mojom::TorConfig::tor_watch_path,
+                      GetTorWatchPath(user_data_dir)))))
+      .Times(1);
+  service_->Start();
+  ExecutableReady();
+}
+
+TEST_F(TorPrewarmServiceTest, SkipsRunningTor) {
+  local_state_.SetBoolean(prefs::kTorPrewarm, true);
+  EXPECT_CALL(*launcher_factory(), GetTorPid()).WillRepeatedly(Return(1234));
+  EXPECT_CALL(*launcher_factory(), LaunchTorProcess(_)).Times(0);
+  service_->Start();
+  ExecutableReady();
+}
+
+TEST_F(TorPrewarmServiceTest, SkipsWhenTorDisabled) {
+  local_state_.SetBoolean(prefs::kTorPrewarm, true);
+  local_state_.SetBoolean(prefs::kTorDisabled, true);
+  EXPECT_CALL(*launcher_factory(), LaunchTorProcess(_)).Times(0);
+  service_->Start();
+  ExecutableReady();
+}
+
+}  // namespace tor
@@ -161,15 +161,11 @@ base::FilePath TorProfileServiceImpl::GetTorExecutablePath() {
 }
 
 base::FilePath TorProfileServiceImpl::GetTorDataPath() {
-  DCHECK(!user_data_dir_.empty());
-  return user_data_dir_.Append(FILE_PATH_LITERAL("tor"))
-      .Append(FILE_PATH_LITERAL("data"));
+  return tor::GetTorDataPath(user_data_dir_);
 }
 
 base::FilePath TorProfileServiceImpl::GetTorWatchPath() {
-  DCHECK(!user_data_dir_.empty());
-  return user_data_dir_.Append(FILE_PATH_LITERAL("tor"))
-      .Append(FILE_PATH_LITERAL("watch"));
+  return tor::GetTorWatchPath(user_data_dir_);
 }
 
 void TorProfileServiceImpl::RegisterTorClientUpdater() {
@@ -5,9 +5,10 @@
 
 #include "brave/components/weekly_storage/weekly_storage.h"
 
-#include <numeric>
+#include <algorithm>
 #include <utility>
 
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "base/time/clock.h"
 #include "base/time/default_clock.h"
 #include "base/values.h"
@@ -15,9 +16,12 @@
 #include "components/prefs/scoped_user_pref_update.h"
 
 namespace {
-constexpr size_t kDaysInWeek = 7;
+// Minimum interval between two writes of the pref.
+constexpr base::TimeDelta kSaveInterval = base::TimeDelta::FromSeconds(5);
 }
 
+constexpr size_t WeeklyStorage::kDaysInWeek;
+
 WeeklyStorage::WeeklyStorage(PrefService* prefs, const char* pref_name)
     : prefs_(prefs),
       pref_name_(pref_name),
@@ -37,17 +41,21 @@ WeeklyStorage::WeeklyStorage(PrefService* prefs,
   Load();
 }
 
-WeeklyStorage::~WeeklyStorage() = default;
+WeeklyStorage::~WeeklyStorage() {
+  if (save_timer_.IsRunning()) {
+    SaveNow();
+  }
+}
 
 void WeeklyStorage::AddDelta(uint64_t delta) {
   FilterToWeek();
-  daily_values_.front().value += delta;
+  GetDailyValue(0).value += delta;
   Save();
 }
 
 void WeeklyStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
   FilterToWeek();
-  DailyValue& today = daily_values_.front();
+  DailyValue& today = GetDailyValue(0);
   if (today.value < value) {
     today.value = value;
   }
@@ -58,66 +66,68 @@ uint64_t WeeklyStorage::GetWeeklySum() const {
   // We record only value for last N days.
   const base::Time n_days_ago =
       clock_->Now() - base::TimeDelta::FromDays(kDaysInWeek);
-  return std::accumulate(daily_values_.begin(), daily_values_.end(), 0ull,
-                         [n_days_ago](const uint64_t acc, const auto& u2) {
-                           uint64_t add = 0;
-                           // Check only last continious days.
-                           if (u2.day > n_days_ago) {
-                             add = u2.value;
-                           }
-                           return acc + add;
-                         });
+  uint64_t sum = 0;
+  for (size_t i = 0; i < days_recorded_; ++i) {
+    const DailyValue& daily_value = GetDailyValue(i);
+    // Check only last continious days.
+    if (daily_value.day > n_days_ago) {
+      sum += daily_value.value;
+    }
+  }
+  return sum;
 }
 
 uint64_t WeeklyStorage::GetHighestValueInWeek() const {
   // We record only value for last N days.
   const base::Time n_days_ago =
       clock_->Now() - base::TimeDelta::FromDays(kDaysInWeek);
-  std::list<DailyValue> last_weeks_daily_values(daily_values_.size());
-  auto copied_it =
-      std::copy_if(daily_values_.begin(), daily_values_.end(),
-                   last_weeks_daily_values.begin(),
-                   [n_days_ago](auto i) { return i.day > n_days_ago; });
-  last_weeks_daily_values.resize(
-      std::distance(last_weeks_daily_values.begin(), copied_it));
-
-  auto highest_it = std::max_element(last_weeks_daily_values.begin(),
-                                     last_weeks_daily_values.end(),
-                                     [](const auto& left, const auto& right) {
-                                       return left.value < right.value;
-                                     });
-  if (highest_it == last_weeks_daily_values.end()) {
-    return 0;
+  uint64_t highest = 0;
+  for (size_t i = 0; i < days_recorded_; ++i) {
+    const DailyValue& daily_value = GetDailyValue(i);
+    if (daily_value.day > n_days_ago) {
+      highest = std::max(highest, daily_value.value);
+    }
   }
-  return highest_it->value;
+  return highest;
 }
 
 bool WeeklyStorage::IsOneWeekPassed() const {
   // TODO(iefremov): This is not true 100% (if the browser was launched once
   // per week just after installation, for example).
-  return daily_values_.size() == kDaysInWeek;
+  return days_recorded_ == kDaysInWeek;
+}
+
+WeeklyStorage::DailyValue& WeeklyStorage::GetDailyValue(size_t days_back) {
+  DCHECK_LT(days_back, days_recorded_);
+  return daily_values_[(newest_ + days_back) % kDaysInWeek];
+}
+
+const WeeklyStorage::DailyValue& WeeklyStorage::GetDailyValue(
+    size_t days_back) const {
+  DCHECK_LT(days_back, days_recorded_);
+  return daily_values_[(newest_ + days_back) % kDaysInWeek];
 }
 
 void WeeklyStorage::FilterToWeek() {
   base::Time now_midnight = clock_->Now().LocalMidnight();
   base::Time last_saved_midnight;
 
-  if (!daily_values_.empty()) {
-    last_saved_midnight = daily_values_.front().day;
+  if (days_recorded_ > 0) {
+    last_saved_midnight = GetDailyValue(0).day;
   }
 
   if (now_midnight - last_saved_midnight > base::TimeDelta()) {
     // Day changed. Since we consider only small incoming intervals, lets just
-    // save it with a new timestamp.
-    daily_values_.push_front({now_midnight, 0});
-    if (daily_values_.size() > kDaysInWeek) {
-      daily_values_.pop_back();
-    }
+    // save it with a new timestamp. This overwrites the oldest day once the
+    // week is full.
+    newest_ = (newest_ + kDaysInWeek - 1) % kDaysInWeek;
+    days_recorded_ = std::min(days_recorded_ + 1, kDaysInWeek);
+    GetDailyValue(0) = {now_midnight, 0};
   }
 }
 
 void WeeklyStorage::Load() {
-  DCHECK(daily_values_.empty());
+  DCHECK_EQ(days_recorded_, 0u);
   const base::ListValue* list = prefs_->GetList(pref_name_);
   if (!list) {
     return;
@@ -128,26 +138,51 @@ void WeeklyStorage::Load() {
     if (!day || !value || !day->is_double() || !value->is_double()) {
       continue;
     }
-    if (daily_values_.size() == kDaysInWeek) {
+    if (days_recorded_ == kDaysInWeek) {
       break;
     }
-    daily_values_.push_back({base::Time::FromDoubleT(day->GetDouble()),
-                             static_cast<uint64_t>(value->GetDouble())});
+    ++days_recorded_;
+    GetDailyValue(days_recorded_ - 1) = {
+        base::Time::FromDoubleT(day->GetDouble()),
+        static_cast<uint64_t>(value->GetDouble())};
   }
 }
 
 void WeeklyStorage::Save() {
-  DCHECK(!daily_values_.empty());
-  DCHECK_LE(daily_values_.size(), kDaysInWeek);
+  DCHECK_GT(days_recorded_, 0u);
+
+  if (save_timer_.IsRunning()) {
+    // The pending write will pick this change up.
+    return;
+  }
+
+  const base::TimeDelta since_last_save =
+      base::TimeTicks::Now() - last_save_time_;
+  if (since_last_save >= kSaveInterval ||
+      !base::SequencedTaskRunnerHandle::IsSet()) {
+    SaveNow();
+    return;
+  }
+
+  save_timer_.Start(FROM_HERE, kSaveInterval - since_last_save, this,
+                    &WeeklyStorage::SaveNow);
+}
+
+void WeeklyStorage::SaveNow() {
+  DCHECK_GT(days_recorded_, 0u);
+  DCHECK_LE(days_recorded_, kDaysInWeek);
+
+  save_timer_.Stop();
+  last_save_time_ = base::TimeTicks::Now();
 
   ListPrefUpdate update(prefs_, pref_name_);
   base::ListValue* list = update.Get();
-  // TODO(iefremov): Optimize if needed.
   list->Clear();
-  for (const auto& u : daily_values_) {
+  for (size_t i = 0; i < days_recorded_; ++i) {
+    const DailyValue& daily_value = GetDailyValue(i);
     base::DictionaryValue value;
-    value.SetKey("day", base::Value(u.day.ToDoubleT()));
-    value.SetDoubleKey("value", u.value);
+    value.SetKey("day", base::Value(daily_value.day.ToDoubleT()));
+    value.SetDoubleKey("value", daily_value.value);
     list->Append(std::move(value));
   }
 }
@@ -6,10 +6,11 @@
 #ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
 #define BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
 
-#include <list>
+#include <array>
 #include <memory>
 
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 
 namespace base {
 class Clock;
@@ -20,6 +21,9 @@ class PrefService;
 // Mostly used by various P3A recorders - allows to track a sum of some
 // values added from time to time via |AddDelta| over a last week.
 // Requires |pref_name| to be already registered.
+// Writes to |pref_name| are coalesced: a change is saved right away unless
+// another one was saved less than a few seconds ago, in which case it is
+// saved once that interval has passed, or on destruction.
 // Feel free to improve and refactor it - templatize a stored value type,
 // change weekly interval or make a keyed service from it.
 class WeeklyStorage {
@@ -42,19 +46,32 @@ class WeeklyStorage {
   bool IsOneWeekPassed() const;
 
  private:
+  static constexpr size_t kDaysInWeek = 7;
+
   struct DailyValue {
     base::Time day;
     uint64_t value = 0ull;
   };
+
+  // Returns the value |days_back| recorded days before the newest one.
+  DailyValue& GetDailyValue(size_t days_back);
+  const DailyValue& GetDailyValue(size_t days_back) const;
   void FilterToWeek();
   void Load();
   void Save();
+  void SaveNow();
 
   PrefService* prefs_ = nullptr;
   const char* pref_name_ = nullptr;
   std::unique_ptr<base::Clock> clock_;
 
-  std::list<DailyValue> daily_values_;
+  // Ring buffer of the recorded days, newest first starting at |newest_|.
+  std::array<DailyValue, kDaysInWeek> daily_values_;
+  size_t newest_ = 0;
+  size_t days_recorded_ = 0;
+
+  base::TimeTicks last_save_time_;
+  base::OneShotTimer save_timer_;
 };
 
 #endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
@@ -9,15 +9,17 @@
 #include <utility>
 
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+constexpr char kPrefName[] = "brave.weekly_test";
+
 class WeeklyStorageTest : public ::testing::Test {
  public:
   WeeklyStorageTest() : clock_(new base::SimpleTestClock) {
-    constexpr char kPrefName[] = "brave.weekly_test";
     pref_service_.registry()->RegisterListPref(kPrefName);
 
     state_ = std::make_unique<WeeklyStorage>(
@@ -26,6 +28,17 @@ class WeeklyStorageTest : public ::testing::Test {
   }
 
  protected:
+  size_t GetSavedDaysCount() {
+    return pref_service_.GetList(kPrefName)->GetList().size();
+  }
+
+  uint64_t GetSavedTodaysValue() {
+    const base::Value& today = pref_service_.GetList(kPrefName)->GetList()[0];
+    return static_cast<uint64_t>(today.FindDoubleKey("value").value_or(0));
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   base::SimpleTestClock* clock_;
   TestingPrefServiceSimple pref_service_;
   std::unique_ptr<WeeklyStorage> state_;
@@ -138,3 +151,43 @@ TEST_F(WeeklyStorageTest, GetsHighestValueInWeekFromReplacement) {
   // Sanity check disparate days were not replaced
   EXPECT_EQ(state_->GetWeeklySum(), high_value + low_value);
 }
+
+TEST_F(WeeklyStorageTest, CoalescesWrites) {
+  // The first change is saved right away.
+  state_->AddDelta(1);
+  EXPECT_EQ(GetSavedTodaysValue(), 1ULL);
+
+  // Changes that follow shortly after are saved together.
+  state_->AddDelta(1);
+  state_->AddDelta(1);
+  EXPECT_EQ(GetSavedTodaysValue(), 1ULL);
+  EXPECT_EQ(state_->GetWeeklySum(), 3ULL);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(5));
+  EXPECT_EQ(GetSavedTodaysValue(), 3ULL);
+
+  // A pending write is flushed on destruction.
+  state_->AddDelta(1);
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  state_->AddDelta(1);
+  EXPECT_EQ(GetSavedTodaysValue(), 3ULL);
+  state_.reset();
+  EXPECT_EQ(GetSavedTodaysValue(), 5ULL);
+}
+
+TEST_F(WeeklyStorageTest, KeepsAtMostOneWeek) {
+  for (int day = 0; day < 10; day++) {
+    clock_->Advance(base::TimeDelta::FromDays(1));
+    state_->AddDelta(day);
+    task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(5));
+  }
+  EXPECT_TRUE(state_->IsOneWeekPassed());
+  EXPECT_EQ(GetSavedDaysCount(), 7u);
+  EXPECT_EQ(GetSavedTodaysValue(), 9ULL);
+  EXPECT_EQ(state_->GetHighestValueInWeek(), 9ULL);
+
+  // Reloading from prefs gives back the same week.
+  state_ = std::make_unique<WeeklyStorage>(
+      &pref_service_, kPrefName, std::make_unique<base::SimpleTestClock>());
+  EXPECT_TRUE(state_->IsOneWeekPassed());
+}
@@ -51,6 +51,12 @@ using base::Time;
 
 namespace {
 
+// Upper bounds on how many history rows and favicons are sent to the browser
+// process in a single bridge call, so that a large profile is streamed
+// instead of being held in memory and sent in one huge message.
+constexpr size_t kHistoryBatchSize = 1000;
+constexpr size_t kFaviconBatchSize = 100;
+
 // Most of below code is copied from os_crypt_win.cc
 #if defined(OS_WIN)
 // Contains base64 random key encrypted with DPAPI.
@@ -176,8 +182,9 @@ bool PasswordFormToImportedPasswordForm(
 
 }  // namespace
 
-ChromeImporter::ChromeImporter() {
-}
+ChromeImporter::ChromeImporter()
+    : history_batch_size_(kHistoryBatchSize),
+      favicon_batch_size_(kFaviconBatchSize) {}
 
 ChromeImporter::~ChromeImporter() {
 }
@@ -262,6 +269,10 @@ void ChromeImporter::ImportHistory() {
     row.visit_count = s.ColumnInt(4);
 
     rows.push_back(row);
+    if (rows.size() >= history_batch_size_) {
+      bridge_->SetHistoryItems(rows, importer::VISIT_SOURCE_CHROME_IMPORTED);
+      rows.clear();
+    }
   }
 
   if (!rows.empty() && !cancelled())
@@ -333,11 +344,8 @@ void ChromeImporter::ImportBookmarks() {
   FaviconMap favicon_map;
   ImportFaviconURLs(&db, &favicon_map);
   // Write favicons into profile.
-  if (!favicon_map.empty() && !cancelled()) {
-    favicon_base::FaviconUsageDataList favicons;
-    LoadFaviconData(&db, favicon_map, &favicons);
-    bridge_->SetFavicons(favicons);
-  }
+  if (!favicon_map.empty() && !cancelled())
+    LoadFaviconData(&db, favicon_map);
 }
 
 void ChromeImporter::ImportFaviconURLs(
@@ -353,10 +361,8 @@ void ChromeImporter::ImportFaviconURLs(
   }
 }
 
-void ChromeImporter::LoadFaviconData(
-    sql::Database* db,
-    const FaviconMap& favicon_map,
-    favicon_base::FaviconUsageDataList* favicons) {
+void ChromeImporter::LoadFaviconData(sql::Database* db,
+                                     const FaviconMap& favicon_map) {
   const char query[] = "SELECT f.url, fb.image_data "
                        "FROM favicons f "
                        "JOIN favicon_bitmaps fb "
@@ -367,8 +373,9 @@ void ChromeImporter::LoadFaviconData(
   if (!s.is_valid())
     return;
 
+  favicon_base::FaviconUsageDataList favicons;
   for (FaviconMap::const_iterator i = favicon_map.begin();
-       i != favicon_map.end(); ++i) {
+       i != favicon_map.end() && !cancelled(); ++i) {
     s.BindInt64(0, i->first);
     if (s.Step()) {
       favicon_base::FaviconUsageData usage;
@@ -386,10 +393,23 @@ void ChromeImporter::LoadFaviconData(
         continue;  // Unable to decode.
 
       usage.urls = i->second;
-      favicons->push_back(usage);
+      favicons.push_back(usage);
     }
     s.Reset(true);
+
+    if (favicons.size() >= favicon_batch_size_) {
+      bridge_->SetFavicons(favicons);
+      favicons.clear();
+    }
   }
+
+  if (!favicons.empty() && !cancelled())
+    bridge_->SetFavicons(favicons);
+}
+
+void ChromeImporter::SetBatchSizeForTesting(size_t batch_size) {
+  history_batch_size_ = batch_size;
+  favicon_batch_size_ = batch_size;
 }
 
 void ChromeImporter::RecursiveReadBookmarksFolder(
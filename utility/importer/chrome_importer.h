@@ -6,6 +6,7 @@
 #ifndef BRAVE_UTILITY_IMPORTER_CHROME_IMPORTER_H_
 #define BRAVE_UTILITY_IMPORTER_CHROME_IMPORTER_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <map>
@@ -39,6 +40,9 @@ class ChromeImporter : public Importer {
                    uint16_t items,
                    ImporterBridge* bridge) override;
 
+  // Caps the number of history rows and favicons sent per bridge call.
+  void SetBatchSizeForTesting(size_t batch_size);
+
  protected:
   ~ChromeImporter() override;
 
@@ -62,10 +66,9 @@ class ChromeImporter : public Importer {
     sql::Database* db,
     FaviconMap* favicon_map);
 
-  // Loads and reencodes the individual favicons.
-  void LoadFaviconData(sql::Database* db,
-                       const FaviconMap& favicon_map,
-                       favicon_base::FaviconUsageDataList* favicons);
+  // Loads and reencodes the individual favicons, sending them to the bridge
+  // in batches.
+  void LoadFaviconData(sql::Database* db, const FaviconMap& favicon_map);
 
   void RecursiveReadBookmarksFolder(
     const base::DictionaryValue* folder,
@@ -73,6 +76,9 @@ class ChromeImporter : public Importer {
     bool is_in_toolbar,
     std::vector<ImportedBookmarkEntry>* bookmarks);
 
+  size_t history_batch_size_;
+  size_t favicon_batch_size_;
+
   DISALLOW_COPY_AND_ASSIGN(ChromeImporter);
 };
 
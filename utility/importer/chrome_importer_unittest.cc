@@ -87,6 +87,31 @@ TEST_F(ChromeImporterTest, ImportHistory) {
   EXPECT_EQ("https://www.nytimes.com/", history[2].url.spec());
 }
 
+TEST_F(ChromeImporterTest, ImportHistoryInBatches) {
+  std::vector<ImporterURLRow> history;
+
+  EXPECT_CALL(*bridge_, NotifyStarted());
+  EXPECT_CALL(*bridge_, NotifyItemStarted(importer::HISTORY));
+  EXPECT_CALL(*bridge_, SetHistoryItems(_, _))
+      .Times(2)
+      .WillRepeatedly(
+          [&history](const std::vector<ImporterURLRow>& rows,
+                     importer::VisitSource visit_source) {
+            EXPECT_LE(rows.size(), 2u);
+            history.insert(history.end(), rows.begin(), rows.end());
+          });
+  EXPECT_CALL(*bridge_, NotifyItemEnded(importer::HISTORY));
+  EXPECT_CALL(*bridge_, NotifyEnded());
+
+  importer_->SetBatchSizeForTesting(2);
+  importer_->StartImport(profile_, importer::HISTORY, bridge_.get());
+
+  ASSERT_EQ(3u, history.size());
+  EXPECT_EQ("https://brave.com/", history[0].url.spec());
+  EXPECT_EQ("https://github.com/brave", history[1].url.spec());
+  EXPECT_EQ("https://www.nytimes.com/", history[2].url.spec());
+}
+
 TEST_F(ChromeImporterTest, ImportBookmarks) {
   std::vector<ImportedBookmarkEntry> bookmarks;
 
@@ -137,6 +162,33 @@ TEST_F(ChromeImporterTest, ImportFavicons) {
             favicons[3].favicon_url.spec());
 }
 
+TEST_F(ChromeImporterTest, ImportFaviconsInBatches) {
+  favicon_base::FaviconUsageDataList favicons;
+
+  EXPECT_CALL(*bridge_, NotifyStarted());
+  EXPECT_CALL(*bridge_, NotifyItemStarted(importer::FAVORITES));
+  EXPECT_CALL(*bridge_, SetFavicons(_))
+      .Times(2)
+      .WillRepeatedly(
+          [&favicons](const favicon_base::FaviconUsageDataList& batch) {
+            EXPECT_LE(batch.size(), 3u);
+            favicons.insert(favicons.end(), batch.begin(), batch.end());
+          });
+  EXPECT_CALL(*bridge_, NotifyItemEnded(importer::FAVORITES));
+  EXPECT_CALL(*bridge_, NotifyEnded());
+
+  importer_->SetBatchSizeForTesting(3);
+  importer_->StartImport(profile_, importer::FAVORITES, bridge_.get());
+
+  ASSERT_EQ(4u, favicons.size());
+  EXPECT_EQ("https://www.google.com/favicon.ico",
+            favicons[0].favicon_url.spec());
+  EXPECT_EQ("https://static.nytimes.com/favicon.ico",
+            favicons[3].favicon_url.spec());
+  for (const auto& favicon : favicons)
+    EXPECT_FALSE(favicon.png_data.empty());
+}
+
 // The mock keychain only works on macOS, so only run this test on macOS (for
 // now)
 #if defined(OS_MAC)